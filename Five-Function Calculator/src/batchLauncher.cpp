@@ -0,0 +1,933 @@
+#include "cache/expressionCache.hpp"
+#include "columns/columnEvaluator.hpp"
+#include "columns/columnKernels.hpp"
+#include "engine/adaptiveEngine.hpp"
+#include "engine/engine.hpp"
+#include "format/resultFormat.hpp"
+#include "input/lineScanner.hpp"
+#include "input/mappedFile.hpp"
+#include "program/program.hpp"
+#include "stream/streamEvaluator.hpp"
+#include "threadPool/workStealingPool.hpp"
+#include "tracelog/binaryTraceSink.hpp"
+#include "tracelog/bufferedFileSink.hpp"
+#include "tracelog/noTrace.hpp"
+#include "tracelog/traceSink.hpp"
+#include "tracelog/tracelog.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <limits>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Headless batch front end, evaluates newline delimited expressions with the
+// same engine the calculator UI uses and writes one result per line.
+//
+//   calculator_batch [--trace <CalcTrace.txt>] [--trace-format <text|binary>]
+//                    [--durability <mode>] [--cache <entries>] [--threads <n>]
+//                    [--precision <type>] [--checked] [--big-fallback]
+//                    [--format <style>] [--scale <digits>] [--rounding <mode>]
+//                    [--allocations] [--stream] [expressions.txt]
+//   calculator_batch --formula <price+tax%> [--kernels <set>] [values.csv]
+//
+// Reads stdin when no input file is given, tracing is off unless requested.
+// An input file is memory-mapped and each line evaluated straight from the
+// mapping, files that can't be mapped are read as a stream.
+// Binary traces are rendered to text afterwards with calculator_trace_decoder.
+// The durability mode (message, periodic or shutdown) picks how often the
+// trace file is flushed. With --cache, repeated expressions are answered from
+// an LRU cache of compiled programs and results, and the hit and miss counts
+// are reported on stderr, as are the heap allocations of each pipeline stage
+// with --allocations. --threads spreads untraced evaluation over a
+// work-stealing pool with one engine per thread, results keep input order.
+// --precision picks the arithmetic type, double, long (long double, the
+// default and what the calculator UI uses), quad where __float128 exists or
+// decimal, exact fixed point with --scale decimals (6 by default, up to 18)
+// and --rounding half-even (default) or half-up. adaptive evaluates in double
+// and moves only troubled expressions on to long double and quad, how many
+// each precision settled is reported on stderr.
+// --checked tests the IEEE exception flags once per expression instead of
+// checking the operands of every operation. --big-fallback evaluates any
+// expression that overflows, underflows or fails again with arbitrary
+// precision decimals. --format writes results as fixed
+// (six decimals, trailing zeros trimmed), fixed:<decimals>, shortest (round
+// trip) or significant:<digits>. --stream reads stdin in fixed size
+// chunks and evaluates each line while it arrives, so a line of any length
+// is never held whole.
+//
+// With --formula the expression is compiled once and each input line holds
+// comma separated values for its placeholders, in the order they first appear
+// in the formula. Rows are evaluated in double precision by the vectorized
+// column kernels, --kernels picks avx512, avx2, sse2 or scalar explicitly.
+
+static void printUsage()
+{
+    std::cerr << "Usage: calculator_batch [--trace <trace file>] [--trace-format <format>]\n"
+        << "                        [--durability <mode>] [--cache <entries>] [--threads <n>]\n"
+        << "                        [--precision <type>] [--checked] [--big-fallback]\n"
+        << "                        [--format <style>] [--scale <digits>] [--rounding <mode>]\n"
+        << "                        [--allocations] [--stream] [input file]\n"
+        << "  Evaluates one expression per line, reads stdin if no input file is given.\n"
+        << "  --trace-format  text (default) or binary.\n"
+        << "  --durability    trace flush mode: message, periodic (default) or shutdown.\n"
+        << "  --cache         cache up to this many compiled expressions and results.\n"
+        << "  --threads       evaluate on this many threads, 0 for one per core (no tracing).\n"
+        << "  --precision     double, long (default), quad, decimal or adaptive.\n"
+        << "  --scale         decimal places kept by decimal precision, 0 to 18 (default 6).\n"
+        << "  --rounding      decimal rounding, half-even (default) or half-up.\n"
+        << "  --checked       detect overflow from the floating point exception flags.\n"
+        << "  --big-fallback  redo overflowing or failing expressions with arbitrary precision.\n"
+        << "  --allocations   report the heap allocations of each pipeline stage.\n"
+        << "  --format        fixed (default), fixed:<decimals>, shortest or significant:<digits>.\n"
+        << "  --stream        evaluate each line in chunks as it is read (double, long or quad).\n"
+        << "       calculator_batch --formula <expression> [--kernels <set>] [input file]\n"
+        << "  Evaluates the formula once per line of comma separated placeholder values.\n"
+        << "  --kernels       avx512, avx2, sse2 or scalar, the widest supported by default.\n";
+}
+
+enum class Precision
+{
+    double_,
+    long_,
+    quad,
+    decimal,
+    adaptive
+};
+
+struct Options
+{
+    Precision precision{ Precision::long_ };
+    EngineOptions engine;
+    std::size_t cacheCapacity{ 0 };
+    std::size_t threadCount{ 1 };
+    std::string_view formula;
+    const ColumnKernels* kernels{ &bestColumnKernels() };
+    bool stream{ false };
+};
+
+// fixed, shortest, fixed:<decimals> or significant:<digits>.
+static bool parseFormat(const std::string_view text, ResultFormat& format)
+{
+    const std::size_t colon{ text.find(':') };
+    const std::string_view style{ text.substr(0, colon) };
+
+    if (style == "shortest")
+    {
+        format.style = ResultFormat::Style::shortest;
+        return colon == std::string_view::npos;
+    }
+
+    if (style == "fixed")
+    {
+        format.style = ResultFormat::Style::fixed;
+    }
+    else if (style == "significant" && colon != std::string_view::npos)
+    {
+        format.style = ResultFormat::Style::significant;
+    }
+    else
+    {
+        return false;
+    }
+
+    if (colon == std::string_view::npos)
+    {
+        return true;
+    }
+
+    const std::string_view digits{ text.substr(colon + 1) };
+    auto [ptr, err] = std::from_chars(digits.data(), digits.data() + digits.size(), format.precision);
+
+    return err == std::errc() && ptr == digits.data() + digits.size()
+        && format.precision >= 0 && format.precision <= maxFormatPrecision
+        && (format.style != ResultFormat::Style::significant || format.precision > 0);
+}
+
+template <typename Number>
+static void printCacheStatistics(const ExpressionCache<Number>& cache)
+{
+    std::cerr << "Expression cache: " << cache.hits() << " hits, "
+        << cache.misses() << " misses, " << cache.size() << " entries\n";
+}
+
+static void printStageStatistics(const StageStatistics& statistics)
+{
+    std::cerr << "Allocations: " << statistics.allocations(StageStatistics::tokenize) << " tokenize, "
+        << statistics.allocations(StageStatistics::shunt) << " shunt, "
+        << statistics.allocations(StageStatistics::compile) << " compile, "
+        << statistics.allocations(StageStatistics::evaluate) << " evaluate\n";
+}
+
+static void printPrecisionTiers(const PrecisionTiers& tiers)
+{
+    std::cerr << "Precision tiers: " << tiers.count(PrecisionTiers::double_) << " double, "
+        << tiers.count(PrecisionTiers::long_) << " long double, "
+        << tiers.count(PrecisionTiers::quad) << " quad, "
+        << tiers.count(PrecisionTiers::big) << " big\n";
+}
+
+template <typename BatchEngine>
+static void evaluateLines(std::istream& input, std::ostream& output, BatchEngine& engine)
+{
+    std::string line;
+
+    while (std::getline(input, line))
+    {
+        // Tolerate files saved with Windows line endings.
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        output << engine.evaluate(std::string_view{ line }) << '\n';
+    }
+}
+
+template <typename BatchEngine>
+static void evaluateLines(std::string_view text, std::ostream& output, BatchEngine& engine)
+{
+    std::string_view line;
+
+    while (takeLine(text, line))
+    {
+        output << engine.evaluate(line) << '\n';
+    }
+}
+
+// Feeds the input to the stream evaluator a chunk at a time, a line ends at
+// each newline. A carriage return is only dropped right before a newline,
+// which may arrive with the next chunk.
+template <typename Number, typename Trace>
+static int evaluateStream(std::istream& input, std::ostream& output, Trace& trace, const ResultFormat& format)
+{
+    constexpr std::size_t chunkSize{ 64 * 1024 };
+
+    StreamEvaluator<Trace, Number> stream{ trace, format };
+    std::vector<char> chunk(chunkSize);
+    bool lineStarted{ false };
+    bool heldReturn{ false };
+
+    while (input.read(chunk.data(), static_cast<std::streamsize>(chunk.size())) || input.gcount())
+    {
+        std::string_view remaining{ chunk.data(), static_cast<std::size_t>(input.gcount()) };
+
+        while (!remaining.empty())
+        {
+            const std::size_t newline{ remaining.find('\n') };
+            std::string_view piece{ remaining.substr(0, newline) };
+
+            if (heldReturn && newline != 0)
+            {
+                stream.feed("\r");
+            }
+
+            heldReturn = !piece.empty() && piece.back() == '\r';
+
+            if (heldReturn)
+            {
+                piece.remove_suffix(1);
+            }
+
+            stream.feed(piece);
+
+            if (newline == std::string_view::npos)
+            {
+                lineStarted = true;
+                break;
+            }
+
+            output << stream.finish() << '\n';
+            lineStarted = false;
+            heldReturn = false;
+            remaining.remove_prefix(newline + 1);
+        }
+    }
+
+    if (lineStarted)
+    {
+        output << stream.finish() << '\n';
+    }
+
+    return 0;
+}
+
+// Mapped text is already in memory, each line is fed in one piece.
+template <typename Number, typename Trace>
+static int evaluateStream(std::string_view text, std::ostream& output, Trace& trace, const ResultFormat& format)
+{
+    StreamEvaluator<Trace, Number> stream{ trace, format };
+    std::string_view line;
+
+    while (takeLine(text, line))
+    {
+        stream.feed(line);
+        output << stream.finish() << '\n';
+    }
+
+    return 0;
+}
+
+// One line without its line ending, read into storage from a stream or
+// viewed in place in mapped text.
+static bool readLine(std::istream& input, std::string& storage, std::string_view& line)
+{
+    if (!std::getline(input, storage))
+    {
+        return false;
+    }
+
+    if (!storage.empty() && storage.back() == '\r')
+    {
+        storage.pop_back();
+    }
+
+    line = storage;
+    return true;
+}
+
+static bool readLine(std::string_view& text, std::string&, std::string_view& line)
+{
+    return takeLine(text, line);
+}
+
+// Reads up to count lines into lines, reusing the strings already there.
+static std::size_t readLines(std::istream& input, std::vector<std::string>& lines, const std::size_t count)
+{
+    if (lines.size() < count)
+    {
+        lines.resize(count);
+    }
+
+    std::size_t read{ 0 };
+
+    while (read < count && std::getline(input, lines[read]))
+    {
+        if (!lines[read].empty() && lines[read].back() == '\r')
+        {
+            lines[read].pop_back();
+        }
+
+        ++read;
+    }
+
+    return read;
+}
+
+// Lines are read in rounds and cut into tasks for the pool, each worker
+// evaluates with its own engine, made from the arguments that follow the
+// trace. The next round is read while the current one is evaluated, results
+// are written in input order once a round completes.
+template <typename BatchEngine, typename... EngineArguments>
+static void evaluateLinesParallel(std::istream& input, std::ostream& output,
+    const std::size_t threadCount, const EngineArguments&... engineArguments)
+{
+    constexpr std::size_t linesPerTask{ 512 };
+    constexpr std::size_t linesPerRound{ 256 * 1024 };
+
+    WorkStealingPool pool{ threadCount };
+
+    NoTrace noTrace;
+    // Engines own their memory pools and can not move.
+    std::deque<BatchEngine> engines;
+
+    for (std::size_t i = 0; i < pool.size(); ++i)
+    {
+        engines.emplace_back(noTrace, engineArguments...);
+    }
+
+    std::vector<std::string> lines;
+    std::vector<std::string> nextLines;
+    std::vector<std::string> results;
+
+    std::size_t count{ readLines(input, lines, linesPerRound) };
+
+    while (count)
+    {
+        results.resize(count);
+
+        for (std::size_t first = 0; first < count; first += linesPerTask)
+        {
+            const std::size_t last{ std::min(first + linesPerTask, count) };
+
+            pool.submit([&, first, last](const std::size_t worker) {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    results[i] = engines[worker].evaluate(std::string_view{ lines[i] });
+                }
+            });
+        }
+
+        const std::size_t nextCount{ readLines(input, nextLines, linesPerRound) };
+        pool.wait();
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            output << results[i] << '\n';
+        }
+
+        lines.swap(nextLines);
+        count = nextCount;
+    }
+}
+
+// A mapped file is cut into line-aligned ranges up front, one task each.
+// Every task writes its results to its own buffer, the buffers are written
+// in order a round of tasks at a time.
+template <typename BatchEngine, typename... EngineArguments>
+static void evaluateLinesParallel(const std::string_view text, std::ostream& output,
+    const std::size_t threadCount, const EngineArguments&... engineArguments)
+{
+    constexpr std::size_t bytesPerTask{ 64 * 1024 };
+    constexpr std::size_t tasksPerRound{ 256 };
+
+    WorkStealingPool pool{ threadCount };
+
+    NoTrace noTrace;
+    // Engines own their memory pools and can not move.
+    std::deque<BatchEngine> engines;
+
+    for (std::size_t i = 0; i < pool.size(); ++i)
+    {
+        engines.emplace_back(noTrace, engineArguments...);
+    }
+
+    const std::vector<std::string_view> ranges{ splitLines(text, text.size() / bytesPerTask + 1) };
+    std::vector<std::string> results(std::min(tasksPerRound, ranges.size()));
+
+    for (std::size_t first = 0; first < ranges.size(); first += tasksPerRound)
+    {
+        const std::size_t count{ std::min(tasksPerRound, ranges.size() - first) };
+
+        for (std::size_t task = 0; task < count; ++task)
+        {
+            pool.submit([&, first, task](const std::size_t worker) {
+                std::string& buffer{ results[task] };
+                std::string_view range{ ranges[first + task] };
+                std::string_view line;
+
+                buffer.clear();
+
+                while (takeLine(range, line))
+                {
+                    buffer += engines[worker].evaluate(line);
+                    buffer += '\n';
+                }
+            });
+        }
+
+        pool.wait();
+
+        for (std::size_t task = 0; task < count; ++task)
+        {
+            output << results[task];
+        }
+    }
+}
+
+// Reads the formula's rows in blocks, evaluates each block column-wise and
+// writes one result per row. Values that don't parse become NaN, which the
+// kernels report as an error for that row.
+template <typename Trace, typename Input>
+static void evaluateFormula(Input& input, std::ostream& output, Trace& trace,
+    const std::string_view formula, const ColumnKernels& kernels, const ResultFormat& format)
+{
+    constexpr std::size_t rowsPerBlock{ 64 * 1024 };
+
+    Engine<Trace, double> engine{ trace };
+    Program<double> program;
+    engine.compileFormula(formula, program);
+
+    const std::size_t columnCount{ program.placeholders().size() };
+    std::vector<std::vector<double>> columns(columnCount);
+    std::vector<std::span<const double>> columnViews(columnCount);
+    std::vector<double> results;
+    std::vector<LaneStatus> statuses;
+    ColumnEvaluator evaluator{ kernels };
+    std::array<char, formatBufferSize<double>> formatted;
+
+    std::string storage;
+    std::string_view line;
+    bool more{ true };
+
+    while (more)
+    {
+        for (std::vector<double>& column : columns)
+        {
+            column.clear();
+        }
+
+        std::size_t rows{ 0 };
+
+        while (rows < rowsPerBlock && (more = readLine(input, storage, line)))
+        {
+            std::string_view remaining{ line };
+
+            for (std::vector<double>& column : columns)
+            {
+                const std::size_t comma{ remaining.find(',') };
+                const std::string_view field{ remaining.substr(0, comma) };
+                remaining = comma == std::string_view::npos ? std::string_view{} : remaining.substr(comma + 1);
+
+                double value{ std::numeric_limits<double>::quiet_NaN() };
+                auto [ptr, err] = std::from_chars(field.data(), field.data() + field.size(), value);
+
+                if (err != std::errc() || ptr != field.data() + field.size())
+                {
+                    value = std::numeric_limits<double>::quiet_NaN();
+                }
+
+                column.push_back(value);
+            }
+
+            ++rows;
+        }
+
+        if (rows == 0)
+        {
+            break;
+        }
+
+        for (std::size_t i = 0; i < columnCount; ++i)
+        {
+            columnViews[i] = columns[i];
+        }
+
+        results.resize(rows);
+        statuses.resize(rows);
+        evaluator.evaluate(program, columnViews, results, statuses);
+
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            if (statuses[row] == LaneStatus::ok)
+            {
+                const char* end{ formatResult(formatted.data(), formatted.data() + formatted.size(),
+                    results[row], format) };
+
+                output.write(formatted.data(), end - formatted.data()) << '\n';
+            }
+            else
+            {
+                output << asWord(statuses[row]) << '\n';
+            }
+        }
+    }
+}
+
+template <typename Number, typename Trace, typename Input>
+static int evaluateAs(Input& input, Trace& trace, const Options& options)
+{
+    if (!options.formula.empty())
+    {
+        // Column kernels are double precision whatever the --precision.
+        evaluateFormula(input, std::cout, trace, options.formula, *options.kernels, options.engine.format);
+        return 0;
+    }
+
+    std::unique_ptr<ExpressionCache<Number>> cache;
+
+    if (options.cacheCapacity)
+    {
+        cache = std::make_unique<ExpressionCache<Number>>(options.cacheCapacity);
+    }
+
+    if (options.threadCount != 1)
+    {
+        evaluateLinesParallel<Engine<NoTrace, Number>>(input, std::cout, options.threadCount,
+            cache.get(), options.engine);
+    }
+    else
+    {
+        Engine<Trace, Number> engine{ trace, cache.get(), options.engine };
+        evaluateLines(input, std::cout, engine);
+    }
+
+    if (cache)
+    {
+        printCacheStatistics(*cache);
+    }
+
+    if (options.engine.statistics)
+    {
+        printStageStatistics(*options.engine.statistics);
+    }
+
+    return 0;
+}
+
+// Same as evaluateAs, tiers reported on stderr after the cache statistics.
+template <typename Trace, typename Input>
+static int evaluateAdaptive(Input& input, Trace& trace, const Options& options)
+{
+    std::unique_ptr<ExpressionCache<double>> cache;
+
+    if (options.cacheCapacity)
+    {
+        cache = std::make_unique<ExpressionCache<double>>(options.cacheCapacity);
+    }
+
+    PrecisionTiers tiers;
+
+    if (options.threadCount != 1)
+    {
+        evaluateLinesParallel<AdaptiveEngine<NoTrace>>(input, std::cout, options.threadCount,
+            cache.get(), options.engine, &tiers);
+    }
+    else
+    {
+        AdaptiveEngine<Trace> engine{ trace, cache.get(), options.engine, &tiers };
+        evaluateLines(input, std::cout, engine);
+    }
+
+    if (cache)
+    {
+        printCacheStatistics(*cache);
+    }
+
+    if (options.engine.statistics)
+    {
+        printStageStatistics(*options.engine.statistics);
+    }
+
+    printPrecisionTiers(tiers);
+    return 0;
+}
+
+// Input is a stream, or the text of a mapped file.
+template <typename Trace, typename Input>
+static int evaluateInput(Input& input, Trace& trace, const Options& options)
+{
+    if (options.stream)
+    {
+        switch (options.precision)
+        {
+        case Precision::double_:
+            return evaluateStream<double>(input, std::cout, trace, options.engine.format);
+
+        case Precision::long_:
+            return evaluateStream<long double>(input, std::cout, trace, options.engine.format);
+
+#ifdef CALCULATOR_HAS_FLOAT128
+        case Precision::quad:
+            return evaluateStream<__float128>(input, std::cout, trace, options.engine.format);
+#endif
+
+        default:
+            std::cerr << "--stream evaluates in double, long or quad precision only\n";
+            return 1;
+        }
+    }
+
+    switch (options.precision)
+    {
+    case Precision::adaptive:
+        if (!options.formula.empty())
+        {
+            return evaluateAs<double>(input, trace, options);
+        }
+
+        return evaluateAdaptive(input, trace, options);
+
+    case Precision::double_:
+        return evaluateAs<double>(input, trace, options);
+
+    case Precision::decimal:
+#ifdef CALCULATOR_HAS_DECIMAL
+        return evaluateAs<Decimal>(input, trace, options);
+#else
+        std::cerr << "Decimal precision is not supported by this build\n";
+        return 1;
+#endif
+
+    case Precision::quad:
+#ifdef CALCULATOR_HAS_FLOAT128
+        return evaluateAs<__float128>(input, trace, options);
+#else
+        std::cerr << "Quad precision is not supported by this build\n";
+        return 1;
+#endif
+
+    default:
+        return evaluateAs<long double>(input, trace, options);
+    }
+}
+
+template <typename Trace>
+static int evaluateSource(std::istream& input, const MappedFile* mapped, Trace& trace, const Options& options)
+{
+    if (mapped)
+    {
+        std::string_view text{ mapped->contents() };
+        return evaluateInput(text, trace, options);
+    }
+
+    return evaluateInput(input, trace, options);
+}
+
+int main(int argc, char* argv[])
+{
+    std::filesystem::path tracePath;
+    std::filesystem::path inputPath;
+    Durability durability{ Durability::periodic };
+    bool binaryTrace{ false };
+    Options options;
+    StageStatistics statistics;
+    int scale{ 6 };
+    bool halfUp{ false };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view argument{ argv[i] };
+
+        if (argument == "--trace" && i + 1 < argc)
+        {
+            tracePath = argv[++i];
+        }
+        else if (argument == "--trace-format" && i + 1 < argc)
+        {
+            std::string_view format{ argv[++i] };
+
+            if (format != "text" && format != "binary")
+            {
+                printUsage();
+                return 1;
+            }
+
+            binaryTrace = format == "binary";
+        }
+        else if (argument == "--durability" && i + 1 < argc)
+        {
+            std::string_view mode{ argv[++i] };
+
+            if (mode == "message")
+            {
+                durability = Durability::everyMessage;
+            }
+            else if (mode == "periodic")
+            {
+                durability = Durability::periodic;
+            }
+            else if (mode == "shutdown")
+            {
+                durability = Durability::onShutdown;
+            }
+            else
+            {
+                printUsage();
+                return 1;
+            }
+        }
+        else if (argument == "--cache" && i + 1 < argc)
+        {
+            std::string_view entries{ argv[++i] };
+            auto [ptr, err] = std::from_chars(entries.data(), entries.data() + entries.size(), options.cacheCapacity);
+
+            if (err != std::errc() || ptr != entries.data() + entries.size() || options.cacheCapacity == 0)
+            {
+                printUsage();
+                return 1;
+            }
+        }
+        else if (argument == "--threads" && i + 1 < argc)
+        {
+            std::string_view threads{ argv[++i] };
+            auto [ptr, err] = std::from_chars(threads.data(), threads.data() + threads.size(), options.threadCount);
+
+            if (err != std::errc() || ptr != threads.data() + threads.size())
+            {
+                printUsage();
+                return 1;
+            }
+        }
+        else if (argument == "--formula" && i + 1 < argc)
+        {
+            options.formula = argv[++i];
+        }
+        else if (argument == "--kernels" && i + 1 < argc)
+        {
+            std::string_view name{ argv[++i] };
+            options.kernels = findColumnKernels(name);
+
+            if (!options.kernels)
+            {
+                std::cerr << "Column kernels not supported here: " << name << '\n';
+                return 1;
+            }
+        }
+        else if (argument == "--precision" && i + 1 < argc)
+        {
+            std::string_view type{ argv[++i] };
+
+            if (type == "double")
+            {
+                options.precision = Precision::double_;
+            }
+            else if (type == "long")
+            {
+                options.precision = Precision::long_;
+            }
+            else if (type == "quad")
+            {
+                options.precision = Precision::quad;
+            }
+            else if (type == "decimal")
+            {
+                options.precision = Precision::decimal;
+            }
+            else if (type == "adaptive")
+            {
+                options.precision = Precision::adaptive;
+            }
+            else
+            {
+                printUsage();
+                return 1;
+            }
+        }
+        else if (argument == "--checked")
+        {
+            options.engine.overflowCheck = OverflowCheck::stickyFlags;
+        }
+        else if (argument == "--allocations")
+        {
+            options.engine.statistics = &statistics;
+        }
+        else if (argument == "--stream")
+        {
+            options.stream = true;
+        }
+        else if (argument == "--big-fallback")
+        {
+            options.engine.bigNumberFallback = true;
+        }
+        else if (argument == "--format" && i + 1 < argc)
+        {
+            if (!parseFormat(argv[++i], options.engine.format))
+            {
+                printUsage();
+                return 1;
+            }
+        }
+        else if (argument == "--scale" && i + 1 < argc)
+        {
+            std::string_view digits{ argv[++i] };
+            auto [ptr, err] = std::from_chars(digits.data(), digits.data() + digits.size(), scale);
+
+            if (err != std::errc() || ptr != digits.data() + digits.size() || scale < 0 || scale > 18)
+            {
+                printUsage();
+                return 1;
+            }
+        }
+        else if (argument == "--rounding" && i + 1 < argc)
+        {
+            std::string_view mode{ argv[++i] };
+
+            if (mode != "half-even" && mode != "half-up")
+            {
+                printUsage();
+                return 1;
+            }
+
+            halfUp = mode == "half-up";
+        }
+        else if (argument == "--help" || argument == "-h")
+        {
+            printUsage();
+            return 0;
+        }
+        else if (inputPath.empty() && !argument.starts_with("--"))
+        {
+            inputPath = argument;
+        }
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+#ifdef CALCULATOR_HAS_DECIMAL
+    Decimal::configure(scale, halfUp ? Decimal::Rounding::halfUp : Decimal::Rounding::halfEven);
+#endif
+
+    // One trace log can only follow one evaluation at a time.
+    if (!tracePath.empty() && options.threadCount != 1)
+    {
+        std::cerr << "--threads can not be combined with --trace\n";
+        return 1;
+    }
+
+    // A stream is one expression at a time, checking every operation.
+    if (options.stream && (options.threadCount != 1 || options.cacheCapacity || !options.formula.empty()
+        || options.engine.overflowCheck != OverflowCheck::perOperation || options.engine.bigNumberFallback
+        || options.engine.statistics))
+    {
+        std::cerr << "--stream can not be combined with --threads, --cache, --formula, --checked, "
+            << "--big-fallback or --allocations\n";
+        return 1;
+    }
+
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    std::ifstream file;
+    std::optional<MappedFile> mapped;
+
+    if (!inputPath.empty())
+    {
+        mapped.emplace(inputPath);
+
+        // Pipes and other files that can't be mapped are read as a stream.
+        if (!mapped->good())
+        {
+            mapped.reset();
+            file.open(inputPath);
+
+            if (!file.is_open())
+            {
+                std::cerr << "Unable to open input file: " << inputPath.string() << '\n';
+                return 1;
+            }
+        }
+    }
+
+    std::istream& input{ inputPath.empty() || mapped ? std::cin : file };
+    const MappedFile* source{ mapped ? &*mapped : nullptr };
+
+    if (tracePath.empty())
+    {
+        NoTrace noTrace;
+        return evaluateSource(input, source, noTrace, options);
+    }
+
+    std::unique_ptr<TraceSink> traceSink;
+
+    if (binaryTrace)
+    {
+        traceSink = std::make_unique<BinaryTraceSink>(tracePath, durability);
+    }
+    else
+    {
+        traceSink = std::make_unique<BufferedFileSink>(tracePath, durability);
+    }
+
+    if (!traceSink->good())
+    {
+        std::cerr << "Unable to open trace file: " << tracePath.string() << '\n';
+        return 1;
+    }
+
+    Tracelog tracelog{ std::move(traceSink) };
+    return evaluateSource(input, source, tracelog, options);
+}
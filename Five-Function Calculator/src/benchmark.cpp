@@ -0,0 +1,432 @@
+#include "enums/enums.hpp"
+#include "evaluator/evaluator.hpp"
+#include "memory/countingResource.hpp"
+#include "program/program.hpp"
+#include "token/token.hpp"
+#include "tokenizer/tokenizer.hpp"
+#include "tracelog/noTrace.hpp"
+#include "tracelog/traceSink.hpp"
+#include "tracelog/tracelog.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Pipeline benchmark and allocation check, runs tokenize -> shunt -> compile
+// -> evaluate stage by stage over a set of expressions and reports the time
+// and the heap allocations each stage takes per expression.
+//
+//   calculator_bench [--check] [--trace] [--rounds <n>] [--tokens <n>] [expressions.txt]
+//
+// Without an input file a fixed mix of generated expressions is used, or with
+// --tokens two expressions of about that many tokens, one parenthesized as
+// deep as it goes and one a long run of small groups. The
+// first round grows every buffer and is not measured. --trace renders every
+// trace event to text and discards it. --check fails with exit code 1 when
+// any stage of an untraced steady-state round allocates, so a regression
+// shows up as a failed run rather than as latency.
+
+namespace
+{
+    std::atomic<std::uint64_t> g_allocations{ 0 };
+
+    void* countedAllocation(const std::size_t size)
+    {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+
+        if (void* pointer{ std::malloc(size ? size : 1) })
+        {
+            return pointer;
+        }
+
+        throw std::bad_alloc{};
+    }
+
+    void* countedAllocation(const std::size_t size, const std::align_val_t alignment)
+    {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+
+        const std::size_t align{ static_cast<std::size_t>(alignment) };
+
+        if (void* pointer{ std::aligned_alloc(align, (size + align - 1) / align * align) })
+        {
+            return pointer;
+        }
+
+        throw std::bad_alloc{};
+    }
+}
+
+// Every allocation in the process goes through these.
+void* operator new(const std::size_t size) { return countedAllocation(size); }
+void* operator new[](const std::size_t size) { return countedAllocation(size); }
+void* operator new(const std::size_t size, const std::align_val_t alignment) { return countedAllocation(size, alignment); }
+void* operator new[](const std::size_t size, const std::align_val_t alignment) { return countedAllocation(size, alignment); }
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+
+namespace
+{
+    enum Stage : std::size_t
+    {
+        tokenize,
+        shunt,
+        compile,
+        evaluate,
+        stageCount
+    };
+
+    constexpr std::array<std::string_view, stageCount> stageNames{ "tokenize", "shunt", "compile", "evaluate" };
+
+    struct StageTotals
+    {
+        std::array<std::uint64_t, stageCount> allocations{};
+        std::array<std::chrono::nanoseconds, stageCount> time{};
+    };
+
+    // Renders each event like a file sink would, then drops the text.
+    class DiscardSink : public TraceSink
+    {
+    public:
+        void write(const std::string&) override { }
+    };
+
+    // Numbers like the ones on a receipt, two to six of them joined by the
+    // four operators, every fourth expression with a percentage at the end.
+    std::vector<std::string> generateExpressions(const std::size_t count)
+    {
+        constexpr std::string_view operators{ "+-*/" };
+
+        std::mt19937 random{ 20240611 };
+        std::uniform_int_distribution<int> value{ 1, 99999 };
+        std::uniform_int_distribution<int> operandCount{ 2, 6 };
+        std::uniform_int_distribution<std::size_t> operation{ 0, operators.size() - 1 };
+
+        std::vector<std::string> expressions(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const int operands{ operandCount(random) };
+
+            for (int operand = 0; operand < operands; ++operand)
+            {
+                if (operand)
+                {
+                    expressions[i] += operators[operation(random)];
+                }
+
+                const int number{ value(random) };
+                expressions[i] += std::to_string(number / 100) + '.' + std::to_string(number % 100);
+            }
+
+            if (i % 4 == 0)
+            {
+                expressions[i] += '+' + std::to_string(value(random) % 25) + '%';
+            }
+        }
+
+        return expressions;
+    }
+
+    // (((1+1)+1)+1) nested tokens / 4 deep, and (1*2-1)+(1*2-1)+... both
+    // evaluate to a count that shows they were read completely.
+    std::vector<std::string> generateLargeExpressions(const std::size_t tokens)
+    {
+        const std::size_t depth{ std::max<std::size_t>(tokens / 4, 1) };
+        const std::size_t groups{ std::max<std::size_t>(tokens / 8, 1) };
+
+        std::string nested(depth, Symbol::openParenthesis);
+        nested += '1';
+
+        for (std::size_t i = 0; i < depth; ++i)
+        {
+            nested += "+1)";
+        }
+
+        std::string wide{ "(1*2-1)" };
+
+        for (std::size_t i = 1; i < groups; ++i)
+        {
+            wide += "+(1*2-1)";
+        }
+
+        return { nested, wide };
+    }
+
+    // Stages and memory set up like Engine's, so the allocations measured
+    // are the ones an engine makes.
+    template <typename Trace>
+    class StageRunner
+    {
+    public:
+        explicit StageRunner(Trace& trace)
+            : m_pool{ &m_upstream },
+            m_tokenizer{ trace },
+            m_evaluator{ trace, OverflowCheck::perOperation, {}, &m_pool },
+            m_tokens{ &m_pool },
+            m_queue{ &m_pool },
+            m_program{ &m_pool }
+        { }
+
+        // One expression through every stage, measuring each when totals is
+        // given. Returns the result's length so nothing is optimized away.
+        std::size_t run(const std::string_view expression, StageTotals* totals)
+        {
+            Clock::time_point start{ Clock::now() };
+            std::uint64_t allocations{ g_allocations.load(std::memory_order_relaxed) };
+
+            const auto measure = [&](const Stage stage) {
+                if (totals)
+                {
+                    const Clock::time_point now{ Clock::now() };
+                    const std::uint64_t count{ g_allocations.load(std::memory_order_relaxed) };
+
+                    totals->time[stage] += now - start;
+                    totals->allocations[stage] += count - allocations;
+                    start = now;
+                    allocations = count;
+                }
+            };
+
+            m_tokenizer.tokenize(expression, m_tokens);
+            measure(Stage::tokenize);
+
+            m_evaluator.shunt(m_tokens, m_queue);
+            measure(Stage::shunt);
+
+            m_evaluator.compile(m_queue, m_program);
+            measure(Stage::compile);
+
+            const std::size_t length{ m_evaluator.evaluate(m_program).size() };
+            measure(Stage::evaluate);
+
+            return length;
+        }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        CountingResource m_upstream;
+        std::pmr::unsynchronized_pool_resource m_pool;
+        Tokenizer<Trace> m_tokenizer;
+        Evaluator<Trace> m_evaluator;
+        TokenStream<long double> m_tokens;
+        TokenStream<long double> m_queue;
+        Program<long double> m_program;
+    };
+
+    template <typename Trace>
+    StageTotals runRounds(Trace& trace, const std::vector<std::string>& expressions, const int rounds)
+    {
+        StageRunner<Trace> runner{ trace };
+        StageTotals totals;
+        std::size_t checksum{ 0 };
+
+        for (const std::string& expression : expressions)
+        {
+            checksum += runner.run(expression, nullptr);
+        }
+
+        for (int round = 0; round < rounds; ++round)
+        {
+            for (const std::string& expression : expressions)
+            {
+                checksum += runner.run(expression, &totals);
+            }
+        }
+
+        std::cerr << "Result characters: " << checksum << '\n';
+        return totals;
+    }
+
+    void printTotals(const StageTotals& totals, const std::uint64_t evaluations)
+    {
+        std::cout << std::left << std::setw(10) << "stage" << std::right
+            << std::setw(14) << "ns/expr" << std::setw(20) << "allocations/expr" << '\n';
+
+        for (std::size_t stage = 0; stage < stageCount; ++stage)
+        {
+            const double nanoseconds{ static_cast<double>(totals.time[stage].count()) / static_cast<double>(evaluations) };
+            const double allocations{ static_cast<double>(totals.allocations[stage]) / static_cast<double>(evaluations) };
+
+            std::cout << std::left << std::setw(10) << stageNames[stage] << std::right << std::fixed
+                << std::setw(14) << std::setprecision(1) << nanoseconds
+                << std::setw(20) << std::setprecision(3) << allocations << '\n';
+        }
+    }
+
+    void printUsage()
+    {
+        std::cerr << "Usage: calculator_bench [--check] [--trace] [--rounds <n>] [--tokens <n>] [input file]\n"
+            << "  Times each pipeline stage and counts its heap allocations per expression.\n"
+            << "  --check   exit with 1 if an untraced steady-state stage allocates.\n"
+            << "  --trace   render every trace event to text while measuring.\n"
+            << "  --rounds  measured passes over the expressions (default 5).\n"
+            << "  --tokens  measure a deeply nested and a long flat expression of about n tokens.\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    bool check{ false };
+    bool trace{ false };
+    int rounds{ 5 };
+    std::size_t tokens{ 0 };
+    std::string_view inputPath;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view argument{ argv[i] };
+
+        if (argument == "--check")
+        {
+            check = true;
+        }
+        else if (argument == "--trace")
+        {
+            trace = true;
+        }
+        else if (argument == "--rounds" && i + 1 < argc)
+        {
+            std::string_view count{ argv[++i] };
+            auto [ptr, err] = std::from_chars(count.data(), count.data() + count.size(), rounds);
+
+            if (err != std::errc() || ptr != count.data() + count.size() || rounds < 1)
+            {
+                printUsage();
+                return 1;
+            }
+        }
+        else if (argument == "--tokens" && i + 1 < argc)
+        {
+            std::string_view count{ argv[++i] };
+            auto [ptr, err] = std::from_chars(count.data(), count.data() + count.size(), tokens);
+
+            if (err != std::errc() || ptr != count.data() + count.size() || !tokens)
+            {
+                printUsage();
+                return 1;
+            }
+        }
+        else if (argument == "--help" || argument == "-h")
+        {
+            printUsage();
+            return 0;
+        }
+        else if (inputPath.empty() && !argument.starts_with("--"))
+        {
+            inputPath = argument;
+        }
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (tokens && !inputPath.empty())
+    {
+        std::cerr << "--tokens generates its own expressions, it can not be combined with an input file\n";
+        return 1;
+    }
+
+    if (check && trace)
+    {
+        std::cerr << "--check measures the untraced pipeline, it can not be combined with --trace\n";
+        return 1;
+    }
+
+    std::vector<std::string> expressions;
+
+    if (tokens)
+    {
+        expressions = generateLargeExpressions(tokens);
+    }
+    else if (inputPath.empty())
+    {
+        expressions = generateExpressions(10'000);
+    }
+    else
+    {
+        std::ifstream file{ std::string{ inputPath } };
+
+        if (!file.is_open())
+        {
+            std::cerr << "Unable to open input file: " << inputPath << '\n';
+            return 1;
+        }
+
+        for (std::string line; std::getline(file, line);)
+        {
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+
+            expressions.push_back(std::move(line));
+        }
+    }
+
+    const std::uint64_t evaluations{ static_cast<std::uint64_t>(expressions.size()) * static_cast<std::uint64_t>(rounds) };
+
+    if (!evaluations)
+    {
+        std::cerr << "No expressions to measure\n";
+        return 1;
+    }
+
+    StageTotals totals;
+
+    if (trace)
+    {
+        Tracelog tracelog{ std::make_unique<DiscardSink>() };
+        totals = runRounds(tracelog, expressions, rounds);
+    }
+    else
+    {
+        NoTrace noTrace;
+        totals = runRounds(noTrace, expressions, rounds);
+    }
+
+    printTotals(totals, evaluations);
+
+    if (!check)
+    {
+        return 0;
+    }
+
+    bool allocated{ false };
+
+    for (std::size_t stage = 0; stage < stageCount; ++stage)
+    {
+        if (totals.allocations[stage])
+        {
+            std::cerr << "FAILED: " << stageNames[stage] << " made " << totals.allocations[stage]
+                << " allocations in steady state\n";
+            allocated = true;
+        }
+    }
+
+    return allocated ? 1 : 0;
+}
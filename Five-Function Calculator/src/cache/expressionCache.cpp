@@ -0,0 +1,124 @@
+#include "expressionCache.hpp"
+
+#include "../number/bigDecimal.hpp"
+#include "../number/decimal.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    // No more shards than entries, so every shard holds at least one.
+    std::size_t shardsFor(const std::size_t capacity, const std::size_t shardCount)
+    {
+        return std::clamp<std::size_t>(shardCount, 1, std::max<std::size_t>(capacity, 1));
+    }
+}
+
+template <typename Number>
+ExpressionCache<Number>::ExpressionCache(std::size_t capacity, std::size_t shardCount)
+    : m_shards{ std::make_unique<Shard[]>(shardsFor(capacity, shardCount)) },
+    m_shardCount{ shardsFor(capacity, shardCount) }
+{
+    capacity = std::max<std::size_t>(capacity, 1);
+
+    // The first shards take the remainder, the capacities add up to the total.
+    for (std::size_t i = 0; i < m_shardCount; ++i)
+    {
+        m_shards[i].capacity = capacity / m_shardCount + (i < capacity % m_shardCount ? 1 : 0);
+    }
+}
+
+template <typename Number>
+std::shared_ptr<const typename ExpressionCache<Number>::Entry> ExpressionCache<Number>::find(const std::string_view expression)
+{
+    Shard& shard{ shardFor(expression) };
+
+    {
+        std::lock_guard lock{ shard.mutex };
+
+        auto found = shard.index.find(expression);
+
+        if (found != shard.index.end())
+        {
+            shard.recency.splice(shard.recency.begin(), shard.recency, found->second);
+            m_hits.fetch_add(1, std::memory_order_relaxed);
+            return found->second->second;
+        }
+    }
+
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+template <typename Number>
+void ExpressionCache<Number>::insert(const std::string_view expression, std::shared_ptr<const Entry> entry)
+{
+    Shard& shard{ shardFor(expression) };
+
+    std::lock_guard lock{ shard.mutex };
+
+    // Another thread may have compiled the same expression in the meantime.
+    auto found = shard.index.find(expression);
+
+    if (found != shard.index.end())
+    {
+        found->second->second = std::move(entry);
+        shard.recency.splice(shard.recency.begin(), shard.recency, found->second);
+        return;
+    }
+
+    if (shard.recency.size() >= shard.capacity)
+    {
+        shard.index.erase(shard.recency.back().first);
+        shard.recency.pop_back();
+    }
+
+    // The index keys view the strings owned by the list nodes, which never move.
+    shard.recency.emplace_front(std::string{ expression }, std::move(entry));
+    shard.index.emplace(shard.recency.front().first, shard.recency.begin());
+}
+
+template <typename Number>
+std::uint64_t ExpressionCache<Number>::hits() const
+{
+    return m_hits.load(std::memory_order_relaxed);
+}
+
+template <typename Number>
+std::uint64_t ExpressionCache<Number>::misses() const
+{
+    return m_misses.load(std::memory_order_relaxed);
+}
+
+template <typename Number>
+std::size_t ExpressionCache<Number>::size() const
+{
+    std::size_t total{ 0 };
+
+    for (std::size_t i = 0; i < m_shardCount; ++i)
+    {
+        std::lock_guard lock{ m_shards[i].mutex };
+        total += m_shards[i].recency.size();
+    }
+
+    return total;
+}
+
+template <typename Number>
+typename ExpressionCache<Number>::Shard& ExpressionCache<Number>::shardFor(const std::string_view expression)
+{
+    return m_shards[std::hash<std::string_view>{}(expression) % m_shardCount];
+}
+
+template class ExpressionCache<double>;
+template class ExpressionCache<long double>;
+
+#ifdef CALCULATOR_HAS_FLOAT128
+template class ExpressionCache<__float128>;
+#endif
+
+#ifdef CALCULATOR_HAS_DECIMAL
+template class ExpressionCache<Decimal>;
+#endif
+
+template class ExpressionCache<BigDecimal>;
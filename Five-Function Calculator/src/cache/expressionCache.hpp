@@ -0,0 +1,69 @@
+#ifndef CALCULATOR_EXPRESSION_CACHE_HPP
+#define CALCULATOR_EXPRESSION_CACHE_HPP
+
+#include "../program/program.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+// Bounded LRU cache of compiled expressions, shared by any number of engines
+// and threads. Entries are spread over independently locked shards so
+// concurrent lookups of different expressions rarely contend.
+//
+// Keyed by the exact expression text - the tokenizer reads any character that
+// is not an operator as part of a number, so even whitespace can change a
+// result and there is no looser normal form. Each numeric type has its own
+// cache, programs compiled for one cannot run on another.
+template <typename Number = long double>
+class ExpressionCache
+{
+public:
+    struct Entry
+    {
+        Program<Number> program;
+
+        // Final result, set for expressions that evaluate to a constant.
+        std::optional<std::string> result;
+    };
+
+    // Capacity is the total entry count, split as evenly as it goes across
+    // the shards, of which there are never more than entries.
+    ExpressionCache(std::size_t capacity, std::size_t shardCount = 16);
+
+    // Returns nullptr on a miss, a hit becomes the shard's most recent entry.
+    std::shared_ptr<const Entry> find(const std::string_view expression);
+    void insert(const std::string_view expression, std::shared_ptr<const Entry> entry);
+
+    std::uint64_t hits() const;
+    std::uint64_t misses() const;
+    std::size_t size() const;
+
+private:
+    struct Shard
+    {
+        using Item = std::pair<std::string, std::shared_ptr<const Entry>>;
+
+        mutable std::mutex mutex;
+        std::list<Item> recency;    // Most recently used first.
+        std::unordered_map<std::string_view, typename std::list<Item>::iterator> index;
+        std::size_t capacity{ 0 };
+    };
+
+    Shard& shardFor(const std::string_view expression);
+
+    std::unique_ptr<Shard[]> m_shards;
+    std::size_t m_shardCount;
+    std::atomic<std::uint64_t> m_hits{ 0 };
+    std::atomic<std::uint64_t> m_misses{ 0 };
+};
+
+#endif
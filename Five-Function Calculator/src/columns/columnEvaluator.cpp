@@ -0,0 +1,185 @@
+#include "columnEvaluator.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    LaneStatus asStatus(const std::string_view failure)
+    {
+        if (failure == Word::overflow)
+        {
+            return LaneStatus::overflow;
+        }
+
+        if (failure == Word::underflow)
+        {
+            return LaneStatus::underflow;
+        }
+
+        return LaneStatus::error;
+    }
+}
+
+ColumnEvaluator::ColumnEvaluator(const ColumnKernels& kernels)
+    : m_kernels{ kernels }
+{ }
+
+void ColumnEvaluator::evaluate(const Program<double>& program,
+    std::span<const std::span<const double>> columns,
+    std::span<double> results,
+    std::span<LaneStatus> statuses)
+{
+    const std::size_t rows{ std::min(results.size(), statuses.size()) };
+    std::fill_n(statuses.begin(), rows, LaneStatus::ok);
+
+    bool missingValues{ columns.size() < program.placeholders().size() };
+
+    for (std::size_t i = 0; i < program.placeholders().size() && !missingValues; ++i)
+    {
+        missingValues = columns[i].size() < rows;
+    }
+
+    if (missingValues)
+    {
+        std::fill_n(statuses.begin(), rows, LaneStatus::error);
+        std::fill_n(results.begin(), rows, 0.0);
+        return;
+    }
+
+    m_stack.resize(std::max(m_stack.size(), program.stackDepth() * blockSize));
+    m_percentage.resize(std::max(m_percentage.size(), program.stackDepth()));
+
+    for (std::size_t first = 0; first < rows; first += blockSize)
+    {
+        const std::size_t count{ std::min(blockSize, rows - first) };
+        evaluateBlock(program, columns, first, count, results.data() + first, statuses.data() + first);
+    }
+}
+
+std::string_view ColumnEvaluator::instructionSet() const
+{
+    return m_kernels.name;
+}
+
+void ColumnEvaluator::evaluateBlock(const Program<double>& program,
+    std::span<const std::span<const double>> columns,
+    const std::size_t first,
+    const std::size_t count,
+    double* results,
+    LaneStatus* statuses)
+{
+    std::size_t top{ 0 };
+    auto constant = program.constants().begin();
+
+    for (const Program<double>::OpCode operation : program.code())
+    {
+        double* slot{ m_stack.data() + top * blockSize };
+
+        switch (operation)
+        {
+        case Program<double>::OpCode::push:
+            [[fallthrough]];
+        case Program<double>::OpCode::pushPercentage:
+            std::fill_n(slot, count, *constant++);
+            m_percentage[top++] = operation == Program<double>::OpCode::pushPercentage;
+            continue;
+
+        case Program<double>::OpCode::load:
+            std::copy_n(columns[static_cast<std::size_t>(*constant++)].data() + first, count, slot);
+            m_percentage[top++] = false;
+            continue;
+
+        case Program<double>::OpCode::loadNegative:
+        {
+            const double* column{ columns[static_cast<std::size_t>(*constant++)].data() + first };
+            std::transform(column, column + count, slot, [](const double value) { return -value; });
+            m_percentage[top++] = false;
+            continue;
+        }
+
+        case Program<double>::OpCode::loadPercentage:
+        {
+            const double* column{ columns[static_cast<std::size_t>(*constant++)].data() + first };
+            std::transform(column, column + count, slot, [](const double value) { return value / 100; });
+            m_percentage[top++] = true;
+            continue;
+        }
+
+        case Program<double>::OpCode::negate:
+        {
+            double* operand{ slot - blockSize };
+            std::transform(operand, operand + count, operand, [](const double value) { return -value; });
+            m_percentage[top - 1] = false;
+            continue;
+        }
+
+        default:
+            break;
+        }
+
+        double* right{ slot - blockSize };
+        double* left{ right - blockSize };
+
+        // A percentage on the right stands for that share of the left operand.
+        if (m_percentage[top - 1])
+        {
+            m_kernels.multiply(right, left, right, count, statuses);
+        }
+
+        switch (operation)
+        {
+        case Program<double>::OpCode::add:
+            m_kernels.add(left, left, right, count, statuses);
+            break;
+
+        case Program<double>::OpCode::subtract:
+            m_kernels.subtract(left, left, right, count, statuses);
+            break;
+
+        case Program<double>::OpCode::multiply:
+            m_kernels.multiply(left, left, right, count, statuses);
+            break;
+
+        default:
+            m_kernels.divide(left, left, right, count, statuses);
+            break;
+        }
+
+        m_percentage[top - 2] = false;
+        --top;
+    }
+
+    if (top == 1)
+    {
+        std::copy_n(m_stack.data(), count, results);
+    }
+    else
+    {
+        std::fill_n(results, count, 0.0);
+    }
+
+    // Problems found while compiling come after any found while running.
+    if (!program.failure().empty())
+    {
+        const LaneStatus failure{ asStatus(program.failure()) };
+        std::replace(statuses, statuses + count, LaneStatus::ok, failure);
+    }
+}
+
+std::string_view asWord(const LaneStatus status)
+{
+    switch (status)
+    {
+    case LaneStatus::overflow:
+        return Word::overflow;
+
+    case LaneStatus::underflow:
+        return Word::underflow;
+
+    case LaneStatus::ok:
+        return {};
+
+    default:
+        return Word::error;
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef CALCULATOR_COLUMN_EVALUATOR_HPP
+#define CALCULATOR_COLUMN_EVALUATOR_HPP
+
+#include "columnKernels.hpp"
+#include "../program/program.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Runs a compiled formula over whole columns of values in double precision,
+// one column per placeholder in Program::placeholders() order, so formulas
+// are compiled by an Engine<Trace, double>. Rows are processed in blocks that
+// keep the operand stack in cache, and every arithmetic instruction is a
+// single kernel call per block.
+class ColumnEvaluator
+{
+public:
+    ColumnEvaluator(const ColumnKernels& kernels = bestColumnKernels());
+
+    // One result and status per row, results.size() rows are evaluated and
+    // every column needs at least that many values. The result of a row is
+    // only meaningful when its status is LaneStatus::ok.
+    void evaluate(const Program<double>& program,
+        std::span<const std::span<const double>> columns,
+        std::span<double> results,
+        std::span<LaneStatus> statuses);
+
+    std::string_view instructionSet() const;
+
+private:
+    static constexpr std::size_t blockSize{ 1024 };
+
+    void evaluateBlock(const Program<double>& program,
+        std::span<const std::span<const double>> columns,
+        const std::size_t first,
+        const std::size_t count,
+        double* results,
+        LaneStatus* statuses);
+
+    const ColumnKernels& m_kernels;
+    std::vector<double> m_stack;
+    std::vector<bool> m_percentage;
+};
+
+// Word shown for a row that did not produce a number.
+std::string_view asWord(const LaneStatus status);
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef CALCULATOR_COLUMN_KERNEL_BODY_HPP
+#define CALCULATOR_COLUMN_KERNEL_BODY_HPP
+
+#include "columnKernels.hpp"
+
+#include <cstddef>
+#include <limits>
+
+// Shared body of the column kernels, included only by the per instruction set
+// translation units. Everything here has internal linkage so the linker can
+// never swap in a copy that was compiled for a wider instruction set than the
+// processor has. Lanes wraps one vector register type:
+//
+//   Vector, width, load, store, add, subtract, multiply, divide, broadcast,
+//   equal (lane bit mask of a == b) and unordered (lane bit mask of NaNs).
+namespace
+{
+    enum class Arithmetic
+    {
+        add,
+        subtract,
+        multiply,
+        divide,
+    };
+
+    struct ScalarLanes
+    {
+        using Vector = double;
+        static constexpr std::size_t width{ 1 };
+
+        static Vector load(const double* source) { return *source; }
+        static void store(double* destination, const Vector value) { *destination = value; }
+        static Vector add(const Vector left, const Vector right) { return left + right; }
+        static Vector subtract(const Vector left, const Vector right) { return left - right; }
+        static Vector multiply(const Vector left, const Vector right) { return left * right; }
+        static Vector divide(const Vector left, const Vector right) { return left / right; }
+        static Vector broadcast(const double value) { return value; }
+        static unsigned equal(const Vector left, const Vector right) { return left == right; }
+        static unsigned unordered(const Vector value) { return value != value; }
+    };
+
+    void flagLanes(LaneStatus* status, unsigned lanes, const LaneStatus problem)
+    {
+        for (; lanes; lanes >>= 1, ++status)
+        {
+            if ((lanes & 1) && *status == LaneStatus::ok)
+            {
+                *status = problem;
+            }
+        }
+    }
+
+    template <typename Lanes, Arithmetic operation>
+    typename Lanes::Vector apply(const typename Lanes::Vector left, const typename Lanes::Vector right)
+    {
+        if constexpr (operation == Arithmetic::add)
+        {
+            return Lanes::add(left, right);
+        }
+        else if constexpr (operation == Arithmetic::subtract)
+        {
+            return Lanes::subtract(left, right);
+        }
+        else if constexpr (operation == Arithmetic::multiply)
+        {
+            return Lanes::multiply(left, right);
+        }
+        else
+        {
+            return Lanes::divide(left, right);
+        }
+    }
+
+    template <typename Lanes, Arithmetic operation>
+    void checkLanes(const typename Lanes::Vector right, const typename Lanes::Vector result, LaneStatus* status)
+    {
+        constexpr double infinity{ std::numeric_limits<double>::infinity() };
+
+        if constexpr (operation == Arithmetic::divide)
+        {
+            if (const unsigned zero{ Lanes::equal(right, Lanes::broadcast(0.0)) })
+            {
+                flagLanes(status, zero, LaneStatus::divideByZero);
+            }
+        }
+
+        const unsigned overflow{ Lanes::equal(result, Lanes::broadcast(infinity)) };
+        const unsigned underflow{ Lanes::equal(result, Lanes::broadcast(-infinity)) };
+        const unsigned error{ Lanes::unordered(result) };
+
+        // Rare, keep the common path free of per lane work.
+        if (overflow | underflow | error)
+        {
+            flagLanes(status, overflow, LaneStatus::overflow);
+            flagLanes(status, underflow, LaneStatus::underflow);
+            flagLanes(status, error, LaneStatus::error);
+        }
+    }
+
+    template <typename Lanes, Arithmetic operation>
+    void run(double* result, const double* left, const double* right, const std::size_t count, LaneStatus* status)
+    {
+        std::size_t i{ 0 };
+
+        for (; i + Lanes::width <= count; i += Lanes::width)
+        {
+            const typename Lanes::Vector divisor{ Lanes::load(right + i) };
+            const typename Lanes::Vector value{ apply<Lanes, operation>(Lanes::load(left + i), divisor) };
+
+            Lanes::store(result + i, value);
+            checkLanes<Lanes, operation>(divisor, value, status + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            const double divisor{ right[i] };
+            const double value{ apply<ScalarLanes, operation>(left[i], divisor) };
+
+            result[i] = value;
+            checkLanes<ScalarLanes, operation>(divisor, value, status + i);
+        }
+    }
+
+    template <typename Lanes>
+    ColumnKernels makeColumnKernels(const std::string_view name)
+    {
+        return ColumnKernels{
+            name,
+            &run<Lanes, Arithmetic::add>,
+            &run<Lanes, Arithmetic::subtract>,
+            &run<Lanes, Arithmetic::multiply>,
+            &run<Lanes, Arithmetic::divide> };
+    }
+}
+
+#endif
@@ -0,0 +1,114 @@
+#include "columnKernels.hpp"
+#include "columnKernelBody.hpp"
+
+#include <initializer_list>
+
+#if defined(CALCULATOR_X86_KERNELS) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace
+{
+#ifdef CALCULATOR_X86_KERNELS
+    enum class InstructionSet
+    {
+        sse2,
+        avx2,
+        avx512,
+    };
+
+    bool supports(const InstructionSet set)
+    {
+#if defined(_MSC_VER)
+        int registers[4]{};
+
+        __cpuid(registers, 1);
+        const bool sse2{ (registers[3] & (1 << 26)) != 0 };
+        const bool osSavesVectors{ (registers[2] & (1 << 27)) != 0 };
+
+        if (set == InstructionSet::sse2)
+        {
+            return sse2;
+        }
+
+        if (!osSavesVectors)
+        {
+            return false;
+        }
+
+        const unsigned long long enabled{ _xgetbv(0) };
+        __cpuidex(registers, 7, 0);
+
+        if (set == InstructionSet::avx2)
+        {
+            return (enabled & 0x6) == 0x6 && (registers[1] & (1 << 5)) != 0;
+        }
+
+        return (enabled & 0xE6) == 0xE6 && (registers[1] & (1 << 16)) != 0;
+#else
+        switch (set)
+        {
+        case InstructionSet::sse2:
+            return __builtin_cpu_supports("sse2");
+
+        case InstructionSet::avx2:
+            return __builtin_cpu_supports("avx2");
+
+        default:
+            return __builtin_cpu_supports("avx512f");
+        }
+#endif
+    }
+#endif
+}
+
+const ColumnKernels& scalarColumnKernels()
+{
+    static const ColumnKernels kernels{ makeColumnKernels<ScalarLanes>("scalar") };
+    return kernels;
+}
+
+const ColumnKernels& bestColumnKernels()
+{
+    static const ColumnKernels& best{ [] () -> const ColumnKernels& {
+        for (const std::string_view name : { "avx512", "avx2", "sse2" })
+        {
+            if (const ColumnKernels* kernels{ findColumnKernels(name) })
+            {
+                return *kernels;
+            }
+        }
+
+        return scalarColumnKernels();
+    }() };
+
+    return best;
+}
+
+const ColumnKernels* findColumnKernels(const std::string_view name)
+{
+    if (name == "scalar")
+    {
+        return &scalarColumnKernels();
+    }
+
+#ifdef CALCULATOR_X86_KERNELS
+    if (name == "sse2" && supports(InstructionSet::sse2))
+    {
+        return &sse2ColumnKernels();
+    }
+
+    if (name == "avx2" && supports(InstructionSet::avx2))
+    {
+        return &avx2ColumnKernels();
+    }
+
+    if (name == "avx512" && supports(InstructionSet::avx512))
+    {
+        return &avx512ColumnKernels();
+    }
+#endif
+
+    return nullptr;
+}
@@ -0,0 +1,54 @@
+#ifndef CALCULATOR_COLUMN_KERNELS_HPP
+#define CALCULATOR_COLUMN_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CALCULATOR_X86_KERNELS
+#endif
+
+// Outcome of a formula for one row, only the first problem in a row is kept.
+enum class LaneStatus : std::uint8_t
+{
+    ok,
+    overflow,
+    underflow,
+    divideByZero,
+    error,
+};
+
+// Element-wise arithmetic over columns of doubles, result[i] = left[i] op right[i].
+// Every operation checks all of its lanes, a zero divisor flags divideByZero,
+// a result of +inf overflow, -inf underflow and NaN error. Lanes that already
+// have a problem keep it. Percentages are applied with multiply, as the value
+// of the right operand is left * right.
+struct ColumnKernels
+{
+    using Operation = void (*)(double* result, const double* left, const double* right,
+        std::size_t count, LaneStatus* status);
+
+    std::string_view name;
+    Operation add;
+    Operation subtract;
+    Operation multiply;
+    Operation divide;
+};
+
+// Widest kernels the processor supports - avx512, avx2, sse2, or scalar.
+const ColumnKernels& bestColumnKernels();
+
+// Kernels by name, nullptr when the build or the processor lacks them.
+const ColumnKernels* findColumnKernels(const std::string_view name);
+
+// One translation unit per instruction set, each compiled for that set alone.
+const ColumnKernels& scalarColumnKernels();
+
+#ifdef CALCULATOR_X86_KERNELS
+const ColumnKernels& sse2ColumnKernels();
+const ColumnKernels& avx2ColumnKernels();
+const ColumnKernels& avx512ColumnKernels();
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+#include "columnKernels.hpp"
+
+#ifdef CALCULATOR_X86_KERNELS
+
+#include "columnKernelBody.hpp"
+
+#include <immintrin.h>
+
+namespace
+{
+    struct Avx2Lanes
+    {
+        using Vector = __m256d;
+        static constexpr std::size_t width{ 4 };
+
+        static Vector load(const double* source) { return _mm256_loadu_pd(source); }
+        static void store(double* destination, const Vector value) { _mm256_storeu_pd(destination, value); }
+        static Vector add(const Vector left, const Vector right) { return _mm256_add_pd(left, right); }
+        static Vector subtract(const Vector left, const Vector right) { return _mm256_sub_pd(left, right); }
+        static Vector multiply(const Vector left, const Vector right) { return _mm256_mul_pd(left, right); }
+        static Vector divide(const Vector left, const Vector right) { return _mm256_div_pd(left, right); }
+        static Vector broadcast(const double value) { return _mm256_set1_pd(value); }
+
+        static unsigned equal(const Vector left, const Vector right)
+        {
+            return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(left, right, _CMP_EQ_OQ)));
+        }
+
+        static unsigned unordered(const Vector value)
+        {
+            return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(value, value, _CMP_UNORD_Q)));
+        }
+    };
+}
+
+const ColumnKernels& avx2ColumnKernels()
+{
+    static const ColumnKernels kernels{ makeColumnKernels<Avx2Lanes>("avx2") };
+    return kernels;
+}
+
+#endif
@@ -0,0 +1,42 @@
+#include "columnKernels.hpp"
+
+#ifdef CALCULATOR_X86_KERNELS
+
+#include "columnKernelBody.hpp"
+
+#include <immintrin.h>
+
+namespace
+{
+    struct Avx512Lanes
+    {
+        using Vector = __m512d;
+        static constexpr std::size_t width{ 8 };
+
+        static Vector load(const double* source) { return _mm512_loadu_pd(source); }
+        static void store(double* destination, const Vector value) { _mm512_storeu_pd(destination, value); }
+        static Vector add(const Vector left, const Vector right) { return _mm512_add_pd(left, right); }
+        static Vector subtract(const Vector left, const Vector right) { return _mm512_sub_pd(left, right); }
+        static Vector multiply(const Vector left, const Vector right) { return _mm512_mul_pd(left, right); }
+        static Vector divide(const Vector left, const Vector right) { return _mm512_div_pd(left, right); }
+        static Vector broadcast(const double value) { return _mm512_set1_pd(value); }
+
+        static unsigned equal(const Vector left, const Vector right)
+        {
+            return static_cast<unsigned>(_mm512_cmp_pd_mask(left, right, _CMP_EQ_OQ));
+        }
+
+        static unsigned unordered(const Vector value)
+        {
+            return static_cast<unsigned>(_mm512_cmp_pd_mask(value, value, _CMP_UNORD_Q));
+        }
+    };
+}
+
+const ColumnKernels& avx512ColumnKernels()
+{
+    static const ColumnKernels kernels{ makeColumnKernels<Avx512Lanes>("avx512") };
+    return kernels;
+}
+
+#endif
@@ -0,0 +1,42 @@
+#include "columnKernels.hpp"
+
+#ifdef CALCULATOR_X86_KERNELS
+
+#include "columnKernelBody.hpp"
+
+#include <emmintrin.h>
+
+namespace
+{
+    struct Sse2Lanes
+    {
+        using Vector = __m128d;
+        static constexpr std::size_t width{ 2 };
+
+        static Vector load(const double* source) { return _mm_loadu_pd(source); }
+        static void store(double* destination, const Vector value) { _mm_storeu_pd(destination, value); }
+        static Vector add(const Vector left, const Vector right) { return _mm_add_pd(left, right); }
+        static Vector subtract(const Vector left, const Vector right) { return _mm_sub_pd(left, right); }
+        static Vector multiply(const Vector left, const Vector right) { return _mm_mul_pd(left, right); }
+        static Vector divide(const Vector left, const Vector right) { return _mm_div_pd(left, right); }
+        static Vector broadcast(const double value) { return _mm_set1_pd(value); }
+
+        static unsigned equal(const Vector left, const Vector right)
+        {
+            return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpeq_pd(left, right)));
+        }
+
+        static unsigned unordered(const Vector value)
+        {
+            return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpunord_pd(value, value)));
+        }
+    };
+}
+
+const ColumnKernels& sse2ColumnKernels()
+{
+    static const ColumnKernels kernels{ makeColumnKernels<Sse2Lanes>("sse2") };
+    return kernels;
+}
+
+#endif
@@ -0,0 +1,80 @@
+#include "engine/engine.hpp"
+#include "number/decimal.hpp"
+#include "tracelog/noTrace.hpp"
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// Checks the exact results of the decimal engine at a few scales, percentages
+// finer than the scale above all, which must be applied with one rounding.
+//
+//   calculator_decimal_check
+//
+// Exits with 1 on the first expression that differs, 0 when every one
+// matches or the build has no decimal engine.
+
+#ifdef CALCULATOR_HAS_DECIMAL
+namespace
+{
+    struct Case
+    {
+        int scale;
+        std::string_view expression;
+        std::string_view expected;
+    };
+
+    constexpr Case cases[]{
+        { 6, "100+5.555555%", "105.555555" },
+        { 6, "1000000+7.123456%", "1071234.56" },
+        { 6, "200*0.5%", "200" },
+        { 6, "0.1+0.2", "0.3" },
+        { 6, "5%", "0.05" },
+        { 6, "-(5%)", "-0.05" },
+        { 6, "5%*2", "0.1" },
+        { 6, "1+1e25%", "ERROR" },
+
+        { 2, "100+5.555555%", "105.56" },
+        { 2, "1000000+7.123456%", "1071234.56" },
+        { 2, "200*0.5%", "200" },
+        { 2, "100000+0.004%", "100004" },
+        { 2, "3-2.5%", "2.92" },
+        { 2, "1003+0.25%", "1005.51" },
+        { 2, "0.5%", "0" },
+
+        { 0, "100+5.555555%", "106" },
+        { 0, "1000000+7.123456%", "1071235" },
+        { 0, "200*0.5%", "200" },
+        { 0, "1001-0.25%", "998" },
+        { 0, "1000-0.25%", "998" },
+        { 0, "-1001-0.25%", "-998" },
+        { 0, "400/0.5%", "200" },
+    };
+}
+
+int main()
+{
+    NoTrace noTrace;
+    Engine<NoTrace, Decimal> engine{ noTrace };
+
+    for (const Case& check : cases)
+    {
+        Decimal::configure(check.scale, Decimal::Rounding::halfEven);
+        const std::string result{ engine.evaluate(check.expression) };
+
+        if (result != check.expected)
+        {
+            std::cerr << "FAILED: scale " << check.scale << " \"" << check.expression << "\" gives " << result
+                << ", expected " << check.expected << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,93 @@
+#include "adaptiveEngine.hpp"
+
+// Each tier checks the sticky flags, the last native one also keeps the
+// result of its own failures.
+static EngineOptions tierOptions(EngineOptions options)
+{
+    options.overflowCheck = OverflowCheck::stickyFlags;
+    options.bigNumberFallback = false;
+    return options;
+}
+
+template <typename Trace>
+AdaptiveEngine<Trace>::AdaptiveEngine(Trace& tracelog, ExpressionCache* cache, const EngineOptions& options,
+    PrecisionTiers* tiers)
+    : m_cache{ cache },
+    m_tiers{ tiers },
+    m_double{ tracelog, nullptr, tierOptions(options) },
+    m_long{ tracelog, nullptr, tierOptions(options) }
+#ifdef CALCULATOR_HAS_FLOAT128
+    , m_quad{ tracelog, nullptr, tierOptions(options) }
+#endif
+{
+    if (options.bigNumberFallback)
+    {
+        m_big = std::make_unique<Engine<Trace, BigDecimal>>(tracelog, nullptr, options);
+    }
+}
+
+template <typename Trace>
+std::string AdaptiveEngine<Trace>::evaluate(const std::string_view expression)
+{
+    if (!m_cache)
+    {
+        return settle(expression);
+    }
+
+    if (std::shared_ptr<const typename ExpressionCache::Entry> cached{ m_cache->find(expression) })
+    {
+        return *cached->result;
+    }
+
+    auto entry = std::make_shared<typename ExpressionCache::Entry>();
+    entry->result = settle(expression);
+
+    std::string result{ *entry->result };
+    m_cache->insert(expression, std::move(entry));
+    return result;
+}
+
+template <typename Trace>
+std::string AdaptiveEngine<Trace>::settle(const std::string_view expression)
+{
+    if (std::optional<std::string> result{ m_double.tryEvaluate(expression) })
+    {
+        count(PrecisionTiers::double_);
+        return std::move(*result);
+    }
+
+#ifdef CALCULATOR_HAS_FLOAT128
+    if (std::optional<std::string> result{ m_long.tryEvaluate(expression) })
+    {
+        count(PrecisionTiers::long_);
+        return std::move(*result);
+    }
+
+    std::string result{ m_quad.evaluate(expression) };
+    PrecisionTiers::Tier tier{ PrecisionTiers::quad };
+#else
+    std::string result{ m_long.evaluate(expression) };
+    PrecisionTiers::Tier tier{ PrecisionTiers::long_ };
+#endif
+
+    if (m_big && (result == Word::overflow || result == Word::underflow || result == Word::error))
+    {
+        result = m_big->evaluate(expression);
+        tier = PrecisionTiers::big;
+    }
+
+    count(tier);
+    return result;
+}
+
+template <typename Trace>
+void AdaptiveEngine<Trace>::count(const PrecisionTiers::Tier tier)
+{
+    if (m_tiers)
+    {
+        m_tiers->settled(tier);
+    }
+}
+
+template class AdaptiveEngine<Tracelog>;
+template class AdaptiveEngine<NoTrace>;
@@ -0,0 +1,72 @@
+#ifndef CALCULATOR_ADAPTIVE_ENGINE_HPP
+#define CALCULATOR_ADAPTIVE_ENGINE_HPP
+
+#include "../cache/expressionCache.hpp"
+#include "../number/bigDecimal.hpp"
+#include "../tracelog/noTrace.hpp"
+#include "../tracelog/tracelog.hpp"
+#include "engine.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+// How many expressions each precision settled, shared by any number of
+// adaptive engines and threads like an ExpressionCache's hit count.
+class PrecisionTiers
+{
+public:
+    enum Tier : std::size_t
+    {
+        double_,
+        long_,
+        quad,       // Only where CALCULATOR_HAS_FLOAT128 is defined.
+        big,        // Only with EngineOptions::bigNumberFallback.
+        tierCount
+    };
+
+    void settled(const Tier tier) { m_settled[tier].fetch_add(1, std::memory_order_relaxed); }
+    std::uint64_t count(const Tier tier) const { return m_settled[tier].load(std::memory_order_relaxed); }
+
+private:
+    std::array<std::atomic<std::uint64_t>, tierCount> m_settled{};
+};
+
+// Evaluates each expression in double and re-evaluates it from its text in
+// long double, then __float128, only when the narrower type reports trouble -
+// see Evaluator::tryEvaluate. The widest type settles whatever reaches it,
+// handing OVERFLOW, UNDERFLOW and ERROR on to BigDecimal when the options ask
+// for the fallback. Every tier checks the sticky flags, so results follow
+// OverflowCheck::stickyFlags whatever the options say.
+//
+// The cache holds final results only, cache hits are not counted in the tiers.
+template <typename Trace = Tracelog>
+class AdaptiveEngine
+{
+public:
+    using ExpressionCache = ::ExpressionCache<double>;
+
+    AdaptiveEngine(Trace& tracelog, ExpressionCache* cache = nullptr, const EngineOptions& options = {},
+        PrecisionTiers* tiers = nullptr);
+
+    std::string evaluate(const std::string_view expression);
+
+private:
+    std::string settle(const std::string_view expression);
+    void count(const PrecisionTiers::Tier tier);
+
+    ExpressionCache* m_cache;
+    PrecisionTiers* m_tiers;
+    Engine<Trace, double> m_double;
+    Engine<Trace, long double> m_long;
+#ifdef CALCULATOR_HAS_FLOAT128
+    Engine<Trace, __float128> m_quad;
+#endif
+    std::unique_ptr<Engine<Trace, BigDecimal>> m_big;
+};
+
+#endif
@@ -0,0 +1,154 @@
+#include "engine.hpp"
+
+template <typename Trace, typename Number>
+Engine<Trace, Number>::Engine(Trace& tracelog, ExpressionCache* cache, const EngineOptions& options)
+    : m_tracelog{ tracelog },
+    m_cache{ cache },
+    m_statistics{ options.statistics },
+    m_upstream{ options.memory ? options.memory : std::pmr::get_default_resource() },
+    m_pool{ &m_upstream },
+    m_tokenizer{ tracelog },
+    m_evaluator{ tracelog, options.overflowCheck, options.format, &m_pool },
+    m_tokens{ &m_pool },
+    m_queue{ &m_pool },
+    m_program{ &m_pool }
+{
+    if constexpr (!std::is_same_v<Number, BigDecimal>)
+    {
+        if (options.bigNumberFallback)
+        {
+            m_bigNumbers = std::make_unique<Engine<Trace, BigDecimal>>(tracelog, nullptr, options);
+        }
+    }
+}
+
+template <typename Trace, typename Number>
+std::string Engine<Trace, Number>::evaluate(const std::string_view expression)
+{
+    if (!m_cache)
+    {
+        compile(expression, m_program);
+        return evaluateOrFallBack(expression, m_program);
+    }
+
+    if (std::shared_ptr<const typename ExpressionCache::Entry> cached{ m_cache->find(expression) })
+    {
+        return cached->result ? *cached->result : evaluate(cached->program);
+    }
+
+    // Expressions are made of literals only, so every result is a constant.
+    auto entry = std::make_shared<typename ExpressionCache::Entry>();
+    compile(expression, entry->program);
+    entry->result = evaluateOrFallBack(expression, entry->program);
+
+    std::string result{ *entry->result };
+    m_cache->insert(expression, std::move(entry));
+    return result;
+}
+
+template <typename Trace, typename Number>
+std::optional<std::string> Engine<Trace, Number>::tryEvaluate(const std::string_view expression)
+{
+    compile(expression, m_program);
+
+    std::uint64_t counted{ m_upstream.allocations() };
+    const std::optional<std::string_view> result{ m_evaluator.tryEvaluate(m_program) };
+
+    countAllocations(StageStatistics::evaluate, counted);
+    return result ? std::optional<std::string>{ *result } : std::nullopt;
+}
+
+template <typename Trace, typename Number>
+std::string Engine<Trace, Number>::evaluateOrFallBack(const std::string_view expression, const Program& program)
+{
+    std::string result{ evaluate(program) };
+
+    if (m_bigNumbers && (result == Word::overflow || result == Word::underflow || result == Word::error))
+    {
+        return m_bigNumbers->evaluate(expression);
+    }
+
+    return result;
+}
+
+template <typename Trace, typename Number>
+void Engine<Trace, Number>::compile(const std::string_view expression, Program& program)
+{
+    compile(expression, program, false);
+}
+
+template <typename Trace, typename Number>
+std::string Engine<Trace, Number>::evaluate(const Program& program)
+{
+    std::uint64_t counted{ m_upstream.allocations() };
+    std::string result{ m_evaluator.evaluate(program) };
+
+    countAllocations(StageStatistics::evaluate, counted);
+    return result;
+}
+
+template <typename Trace, typename Number>
+void Engine<Trace, Number>::compileFormula(const std::string_view expression, Program& program)
+{
+    compile(expression, program, true);
+}
+
+template <typename Trace, typename Number>
+std::string Engine<Trace, Number>::evaluate(const Program& program, std::span<const Number> values)
+{
+    std::uint64_t counted{ m_upstream.allocations() };
+    std::string result{ m_evaluator.evaluate(program, values) };
+
+    countAllocations(StageStatistics::evaluate, counted);
+    return result;
+}
+
+template <typename Trace, typename Number>
+void Engine<Trace, Number>::compile(const std::string_view expression, Program& program, const bool allowPlaceholders)
+{
+    std::uint64_t counted{ m_upstream.allocations() };
+
+    m_tokenizer.tokenize(expression, m_tokens, allowPlaceholders);
+    m_tracelog.logSendForShunting(m_tokens.size());
+    countAllocations(StageStatistics::tokenize, counted);
+
+    m_evaluator.shunt(m_tokens, m_queue);
+    m_tracelog.logShuntingComplete(m_queue.size());
+    countAllocations(StageStatistics::shunt, counted);
+
+    m_evaluator.compile(m_queue, program);
+    countAllocations(StageStatistics::compile, counted);
+}
+
+// Adds the allocations since counted to the stage, shared counters are only
+// touched when there are any.
+template <typename Trace, typename Number>
+void Engine<Trace, Number>::countAllocations(const StageStatistics::Stage stage, std::uint64_t& counted)
+{
+    const std::uint64_t allocations{ m_upstream.allocations() };
+
+    if (m_statistics && allocations != counted)
+    {
+        m_statistics->add(stage, allocations - counted);
+    }
+
+    counted = allocations;
+}
+
+template class Engine<Tracelog, double>;
+template class Engine<Tracelog, long double>;
+template class Engine<NoTrace, double>;
+template class Engine<NoTrace, long double>;
+
+#ifdef CALCULATOR_HAS_FLOAT128
+template class Engine<Tracelog, __float128>;
+template class Engine<NoTrace, __float128>;
+#endif
+
+#ifdef CALCULATOR_HAS_DECIMAL
+template class Engine<Tracelog, Decimal>;
+template class Engine<NoTrace, Decimal>;
+#endif
+
+template class Engine<Tracelog, BigDecimal>;
+template class Engine<NoTrace, BigDecimal>;
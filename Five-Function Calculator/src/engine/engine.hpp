@@ -0,0 +1,129 @@
+#ifndef CALCULATOR_ENGINE_HPP
+#define CALCULATOR_ENGINE_HPP
+
+#include "../cache/expressionCache.hpp"
+#include "../enums/enums.hpp"
+#include "../evaluator/evaluator.hpp"
+#include "../format/resultFormat.hpp"
+#include "../memory/countingResource.hpp"
+#include "../number/bigDecimal.hpp"
+#include "../program/program.hpp"
+#include "../token/token.hpp"
+#include "../tokenizer/tokenizer.hpp"
+#include "../tracelog/noTrace.hpp"
+#include "../tracelog/tracelog.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Allocations that reached the engines' upstream resource in each stage of
+// the pipeline, shared by any number of engines and threads.
+class StageStatistics
+{
+public:
+    enum Stage : std::size_t
+    {
+        tokenize,
+        shunt,
+        compile,
+        evaluate,
+        stageCount
+    };
+
+    void add(const Stage stage, const std::uint64_t allocations)
+    {
+        m_allocations[stage].fetch_add(allocations, std::memory_order_relaxed);
+    }
+
+    std::uint64_t allocations(const Stage stage) const { return m_allocations[stage].load(std::memory_order_relaxed); }
+
+private:
+    std::array<std::atomic<std::uint64_t>, stageCount> m_allocations{};
+};
+
+struct EngineOptions
+{
+    OverflowCheck overflowCheck{ OverflowCheck::perOperation };
+    ResultFormat format;
+
+    // Expressions that OVERFLOW, UNDERFLOW or end in an ERROR are evaluated
+    // again from their text by a BigDecimal engine, which has no range limits
+    // and reads literals of any size exactly. Compiled programs and formulas
+    // keep the result of their own Number.
+    bool bigNumberFallback{ false };
+
+    // Upstream of each engine's memory pool, the default resource when null.
+    std::pmr::memory_resource* memory{ nullptr };
+
+    // Receives the allocations of each stage when set.
+    StageStatistics* statistics{ nullptr };
+};
+
+// Headless front end for the tokenize -> shunt -> compile -> evaluate pipeline.
+// Shared by the calculator UI and the batch launcher so both produce
+// identical results, has no wxWidgets dependency. The batch launcher runs
+// Engine<NoTrace> unless a trace file is requested. Number selects the
+// arithmetic type of every stage, see NumberTraits.
+//
+// Each engine has its own unsynchronized pool for the token streams, program
+// and operator and operand stacks it reuses. Once their capacity has grown, an
+// expression allocates nothing but its result string. An engine is used by
+// one thread at a time, so batch workers each get a pool of their own.
+template <typename Trace = Tracelog, typename Number = long double>
+class Engine
+{
+public:
+    using Program = ::Program<Number>;
+    using ExpressionCache = ::ExpressionCache<Number>;
+
+    // With a cache, repeated expressions skip the whole pipeline - and their
+    // trace, as nothing is tokenized or evaluated again.
+    // A cache holds results, so engines sharing one should also share their
+    // options.
+    Engine(Trace& tracelog, ExpressionCache* cache = nullptr, const EngineOptions& options = {});
+
+    std::string evaluate(const std::string_view expression);
+
+    // Uncached, for AdaptiveEngine. Nothing when the expression needs a wider
+    // Number, see Evaluator::tryEvaluate.
+    std::optional<std::string> tryEvaluate(const std::string_view expression);
+
+    // For formulas evaluated repeatedly, compile once and evaluate the
+    // program as often as needed.
+    void compile(const std::string_view expression, Program& program);
+    std::string evaluate(const Program& program);
+
+    // Formulas may name placeholders (price+tax%) that are given values when
+    // evaluated, here one row at a time or by ColumnEvaluator for whole
+    // columns. Values follow the order of Program::placeholders().
+    void compileFormula(const std::string_view expression, Program& program);
+    std::string evaluate(const Program& program, std::span<const Number> values);
+
+private:
+    void compile(const std::string_view expression, Program& program, const bool allowPlaceholders);
+    void countAllocations(const StageStatistics::Stage stage, std::uint64_t& counted);
+    std::string evaluateOrFallBack(const std::string_view expression, const Program& program);
+
+    Trace& m_tracelog;
+    ExpressionCache* m_cache;
+    StageStatistics* m_statistics;
+    CountingResource m_upstream;
+    std::pmr::unsynchronized_pool_resource m_pool;
+    Tokenizer<Trace, Number> m_tokenizer;
+    Evaluator<Trace, Number> m_evaluator;
+    TokenStream<Number> m_tokens;
+    TokenStream<Number> m_queue;
+    Program m_program;
+    std::unique_ptr<Engine<Trace, BigDecimal>> m_bigNumbers;
+};
+
+#endif
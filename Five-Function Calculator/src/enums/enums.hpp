@@ -69,10 +69,17 @@ namespace Symbol
     constexpr char multiply{ '*' };
     constexpr char divide{ '/' };
     constexpr char percent{ '%' };
+    constexpr char percentage{ 'P' };
 	constexpr char overflow{ 'O' };
 	constexpr char underflow{ 'U' };
 	constexpr char divideByZero{ 'Z' };
 	constexpr char invalid{ 'I' };
+	constexpr char outOfRange{ 'R' };
+	constexpr char placeholder{ 'X' };
+	constexpr char negativePlaceholder{ 'Y' };
+	constexpr char percentagePlaceholder{ 'Q' };
+	constexpr char openParenthesis{ '(' };
+	constexpr char closeParenthesis{ ')' };
 }
 
 namespace Word
@@ -82,6 +89,15 @@ namespace Word
 	constexpr std::string_view underflow{ "UNDERFLOW" };
 }
 
+// How arithmetic faults are found. perOperation tests the operands of every
+// operation before and after it, stickyFlags runs the whole program and tests
+// the IEEE exception flags once.
+enum class OverflowCheck
+{
+    perOperation,
+    stickyFlags,
+};
+
 enum class Prescedence
 {
     negative = 30,
@@ -1,196 +1,668 @@
 #include "evaluator.hpp"
 
-Evaluator::Evaluator(Tracelog& tracelog)
-	: m_tracelog{ tracelog }
-{ }
+// The sticky flag checks read the floating point environment.
+#ifdef _MSC_VER
+#pragma fenv_access (on)
+#endif
+
+template <typename Trace, typename Number>
+Evaluator<Trace, Number>::Evaluator(Trace& tracelog, const OverflowCheck overflowCheck,
+    const ResultFormat& format, std::pmr::memory_resource* memory)
+	: m_tracelog{ tracelog },
+    m_overflowCheck{ overflowCheck },
+    m_format{ format },
+    m_formatted(formatBufferSize<Number>, memory),
+    m_operands{ memory },
+    m_operators{ memory }
+{
+    // One digit is left to the rounding of the operations before the result.
+    if constexpr (!NumberTraits<Number>::exact)
+    {
+        for (int digits = NumberTraits<Number>::digits10 - 1; digits > m_format.precision; --digits)
+        {
+            m_fixedDigitsLimit *= 10;
+        }
+
+        for (int digits = NumberTraits<Number>::digits10 - 1; digits < m_format.precision; ++digits)
+        {
+            m_fixedDigitsLimit /= 10;
+        }
+    }
+}
 
-std::queue<Token> Evaluator::shunt(const std::vector<Token>& tokens)
+template <typename Trace, typename Number>
+void Evaluator<Trace, Number>::shunt(const TokenStream& tokens, TokenStream& outputQueue)
 {
-    std::stack<Token> opStack;
-    std::queue<Token> outputQueue;
+    m_operators.clear();
+    outputQueue.clear();
 
-    for (const Token& token : tokens)
+    for (const std::string& name : tokens.placeholders())
     {
-        if (!token.isOperator())
+        outputQueue.addPlaceholder(name);
+    }
+
+    auto value = tokens.values().begin();
+    std::size_t nesting{ 0 };
+
+    // Unbalanced or too deeply nested parentheses leave an invalid number
+    // at the end of the queue, for compile() to report.
+    const auto reject = [&] {
+        m_tracelog.logMoveToOutputQueue(0.0L);
+        outputQueue.push(Token{ Symbol::invalid });
+    };
+
+    for (const char symbol : tokens.symbols())
+    {
+        if (!SymbolTraits::isOperator(symbol))
         {
-            m_tracelog.logMoveToOutputQueue(token.getValue());
-            outputQueue.push(token);
+            m_tracelog.logMoveToOutputQueue(traceValue(*value));
+            outputQueue.push(Token{ symbol, *value });
+            ++value;
             continue;
         }
 
-        m_tracelog.logMoveOperatorToOperatorStack(token.getSymbol());
-        while (!opStack.empty() && opStack.top().getPrescedence() >= token.getPrescedence())
+        m_tracelog.logMoveOperatorToOperatorStack(symbol);
+
+        if (symbol == Symbol::openParenthesis)
         {
-            m_tracelog.logHigherPrescedence(token.getPrescedence(), opStack.top().getPrescedence());
-            outputQueue.push(opStack.top());
-            opStack.pop();
+            if (++nesting > maxNesting)
+            {
+                reject();
+                return;
+            }
+
+            m_operators.push_back(symbol);
+            continue;
         }
 
-        m_tracelog.logPrescedenceOK(token.getSymbol());
-		opStack.push(token);
+        if (symbol == Symbol::closeParenthesis)
+        {
+            while (!m_operators.empty() && m_operators.back() != Symbol::openParenthesis)
+            {
+                m_tracelog.logOpStackToOuptutQueue(m_operators.back());
+                outputQueue.push(Token{ m_operators.back() });
+                m_operators.pop_back();
+            }
+
+            if (m_operators.empty())
+            {
+                reject();
+                return;
+            }
+
+            m_operators.pop_back();
+            --nesting;
+            continue;
+        }
+
+        const Prescedence prescedence{ SymbolTraits::prescedence(symbol) };
+
+        // The negative operator comes before its operand, nothing on the
+        // stack is complete yet.
+        while (symbol != Symbol::negative && !m_operators.empty() && m_operators.back() != Symbol::openParenthesis
+            && SymbolTraits::prescedence(m_operators.back()) >= prescedence)
+        {
+            m_tracelog.logHigherPrescedence(prescedence, SymbolTraits::prescedence(m_operators.back()));
+            outputQueue.push(Token{ m_operators.back() });
+            m_operators.pop_back();
+        }
+
+        m_tracelog.logPrescedenceOK(symbol);
+		m_operators.push_back(symbol);
     }
 
     m_tracelog.logAllTokensAnalyzed();
-    while (!opStack.empty())
+    if (nesting)
+    {
+        reject();
+        return;
+    }
+
+    while (!m_operators.empty())
     {
-        m_tracelog.logOpStackToOuptutQueue(opStack.top().getSymbol());
-		outputQueue.push(opStack.top());
-		opStack.pop();
+        m_tracelog.logOpStackToOuptutQueue(m_operators.back());
+		outputQueue.push(Token{ m_operators.back() });
+		m_operators.pop_back();
     }
-    return outputQueue;
 }
 
-std::string Evaluator::evaluate(std::queue<Token>& queue)
+template <typename Trace, typename Number>
+void Evaluator<Trace, Number>::compile(const TokenStream& queue, Program& program)
 {
-    std::stack<Token> stack;
+    program.clear();
+    program.m_placeholders = queue.placeholders();
+
+    std::size_t depth{ 0 };
+    auto value = queue.values().begin();
 
-    while (!queue.empty())
+    for (const char symbol : queue.symbols())
     {
-        bool error{ queue.front().getSymbol() == Symbol::invalid};
+        if (!SymbolTraits::isOperator(symbol))
+        {
+            const Number number{ *value++ };
+
+            bool error{ symbol == Symbol::invalid || symbol == Symbol::outOfRange };
+
+            m_tracelog.logEvalCheckForErrorResult(error);
+            if (error)
+            {
+                program.m_failure = Word::error;
+                program.m_literalOutOfRange = symbol == Symbol::outOfRange;
+                return;
+            }
+
+            bool overflow{ symbol == Symbol::overflow };
+
+            m_tracelog.logCheckForOverflowFlagSet(overflow);
+            if (overflow)
+            {
+                program.m_failure = Word::overflow;
+                return;
+            }
+
+            bool underflow{ symbol == Symbol::underflow };
+
+            m_tracelog.logCheckForUnderflowFlagSet(underflow);
+            if (underflow)
+            {
+                program.m_failure = Word::underflow;
+                return;
+            }
+
+            // Placeholder symbols double as their load opcodes.
+            switch (symbol)
+            {
+            case Symbol::percentage:
+                program.m_code.push_back(OpCode::pushPercentage);
+                break;
+
+            case Symbol::placeholder:
+                [[fallthrough]];
+            case Symbol::negativePlaceholder:
+                [[fallthrough]];
+            case Symbol::percentagePlaceholder:
+                program.m_code.push_back(static_cast<OpCode>(symbol));
+                break;
+
+            default:
+                program.m_code.push_back(OpCode::push);
+                break;
+            }
+
+            program.m_constants.push_back(number);
+            program.m_stackDepth = std::max(program.m_stackDepth, ++depth);
+            continue;
+        }
+
+        m_tracelog.logOperatorFound(symbol);
+        const std::size_t operandCount{ static_cast<std::size_t>(SymbolTraits::operandCount(symbol)) };
+
+        m_tracelog.logCheckingAvailableOperands(static_cast<int>(operandCount));
+        if (operandCount > depth)
+        {
+            m_tracelog.logErrorFound(depth);
+            program.m_failure = Word::error;
+            return;
+        }
+
+        m_tracelog.logFoundSufficientOperands(depth);
+
+        // Only the four arithmetic operators and negation compile, a percent
+        // sign that was not consumed by a number has nothing to operate on.
+        bool error{ operandCount == 0 };
 
         m_tracelog.logEvalCheckForErrorResult(error);
         if (error)
         {
-            return std::string{ Word::error };
+            program.m_failure = Word::error;
+            return;
+        }
+
+        program.m_code.push_back(static_cast<OpCode>(symbol));
+        depth -= operandCount - 1;
+    }
+
+    m_tracelog.logExpectOneToken(depth == 1);
+    if (depth != 1)
+    {
+        program.m_failure = Word::error;
+    }
+}
+
+template <typename Trace, typename Number>
+std::string_view Evaluator<Trace, Number>::evaluate(const Program& program, std::span<const Number> values)
+{
+    if (values.size() < program.placeholders().size())
+    {
+        return Word::error;
+    }
+
+    if (m_operands.size() < program.stackDepth())
+    {
+        m_operands.resize(program.stackDepth(), Token{ Symbol::none });
+    }
+
+    // Exact types raise their own fault flags, their operand checks would
+    // overflow while checking.
+    if (m_overflowCheck == OverflowCheck::stickyFlags || NumberTraits<Number>::exact)
+    {
+        return evaluateWithFlags(program, values);
+    }
+
+    // One past the top of the operand stack.
+    Token* top{ m_operands.data() };
+    auto constant = program.constants().begin();
+
+    for (const OpCode operation : program.code())
+    {
+        switch (operation)
+        {
+        case OpCode::push:
+            m_tracelog.logNumberToOperandStack(traceValue(*constant));
+            *top++ = Token{ Symbol::none, *constant++ };
+            continue;
+
+        case OpCode::pushPercentage:
+            m_tracelog.logNumberToOperandStack(traceValue(*constant));
+            *top++ = Token{ Symbol::percentage, *constant++ };
+            continue;
+
+        case OpCode::load:
+            *top++ = Token{ Symbol::none, values[static_cast<std::size_t>(*constant++)] };
+            m_tracelog.logNumberToOperandStack(traceValue((top - 1)->getValue()));
+            continue;
+
+        case OpCode::loadNegative:
+            *top++ = Token{ Symbol::none, -values[static_cast<std::size_t>(*constant++)] };
+            m_tracelog.logNumberToOperandStack(traceValue((top - 1)->getValue()));
+            continue;
+
+        case OpCode::loadPercentage:
+            *top++ = Token{ Symbol::percentage, NumberTraits<Number>::percentage(values[static_cast<std::size_t>(*constant++)]) };
+            m_tracelog.logNumberToOperandStack(traceValue((top - 1)->getValue()));
+            continue;
+
+        case OpCode::negate:
+        {
+            const Number operand{ (top - 1)->getValue() };
+            m_tracelog.logDetectedNegativeSymbol(traceValue(operand));
+
+            const bool overflow{ NumberTraits<Number>::negationOverflows(operand) };
+
+            m_tracelog.logCheckForOverflow(overflow);
+            if (overflow)
+            {
+                return Word::overflow;
+            }
+
+            *(top - 1) = Token{ Symbol::none, -operand };
+            continue;
         }
 
-		bool overflow{ queue.front().getSymbol() == Symbol::overflow };
+        default:
+            break;
+        }
+
+        const Token right{ *--top };
+        m_tracelog.logPullingOperandsFromStack(traceValue(right.getValue()));
+
+        const Token left{ *--top };
+        m_tracelog.logPullingOperandsFromStack(traceValue(left.getValue()));
+
+		Token result{ doMath(operation, left, right) };
+
+        bool overflow{ result.getSymbol() == Symbol::overflow };
 
-        m_tracelog.logCheckForOverflowFlagSet(overflow);
+        m_tracelog.logCheckForOverflow(overflow);
         if (overflow)
         {
-            return std::string{ Word::overflow };
+			return Word::overflow;
         }
 
-        bool underflow{ queue.front().getSymbol() == Symbol::underflow };
+        bool underflow{ result.getSymbol() == Symbol::underflow };
 
-        m_tracelog.logCheckForUnderflowFlagSet(underflow);
+        m_tracelog.logCheckForUnderflow(underflow);
         if (underflow)
         {
-            return std::string{ Word::underflow };
+            return Word::underflow;
         }
 
-        if (!queue.front().isOperator())
+        *top++ = result;
+    }
+
+    if (!program.failure().empty())
+    {
+        return program.failure();
+    }
+
+    return format((top - 1)->getValue());
+}
+
+// The common case runs the program without a single check. Only when one of
+// the fault flags is raised afterwards is it run again, testing the flags
+// after every instruction to find the one at fault.
+template <typename Trace, typename Number>
+std::string_view Evaluator<Trace, Number>::evaluateWithFlags(const Program& program, std::span<const Number> values)
+{
+    NumberTraits<Number>::clearFaults();
+    run(program, values, false);
+
+    bool raised{ NumberTraits<Number>::faults() != 0 };
+
+    m_tracelog.logCheckForOverflowFlagSet(raised);
+    if (raised)
+    {
+        const std::string_view fault{ run(program, values, true) };
+
+        if (!fault.empty())
         {
-            m_tracelog.logNumberToOperandStack(queue.front().getValue());
-            stack.push(queue.front());
-            queue.pop();
-            continue;
+            return fault;
         }
+    }
+
+    if (!program.failure().empty())
+    {
+        return program.failure();
+    }
 
-        m_tracelog.logOperatorFound(queue.front().getSymbol());
-        std::vector<Token> operands;
-        int operandCount{ 0 };
+    return format(valueOf(m_operands.front()));
+}
 
-        m_tracelog.logCheckingAvailableOperands(queue.front().getOperandCount());
-        if (queue.front().getOperandCount() > stack.size())
+template <typename Trace, typename Number>
+std::optional<std::string_view> Evaluator<Trace, Number>::tryEvaluate(const Program& program)
+{
+    // Negations that overflow fail to compile with OVERFLOW.
+    if (!program.failure().empty())
+    {
+        if (program.literalOutOfRange() || program.failure() != Word::error)
         {
-            m_tracelog.logErrorFound(stack.size());
-            return std::string{ Word::error };
+            return std::nullopt;
         }
 
-        m_tracelog.logFoundSufficientOperands(stack.size());
-        while (operandCount < queue.front().getOperandCount())
-        {
-            m_tracelog.logPullingOperandsFromStack(stack.top().getValue());
-            operands.push_back(stack.top());
-            stack.pop();
+        return program.failure();
+    }
 
-            ++operandCount;
-        }
+    if (m_operands.size() < program.stackDepth())
+    {
+        m_operands.resize(program.stackDepth(), Token{ Symbol::none });
+    }
 
-		Token result{ doMath(queue.front(), operands) };
+    NumberTraits<Number>::clearFaults();
+    m_cancelled = false;
+    run(program, {}, false, true);
 
-        error = result.getSymbol() == Symbol::percent
-            || result.getSymbol() == Symbol::invalid;
+    const int raised{ NumberTraits<Number>::faults() };
 
-        m_tracelog.logEvalCheckForErrorResult(error);
-        if (error)
+    m_tracelog.logCheckForOverflowFlagSet(raised != 0);
+    if (m_cancelled || (raised & (FE_OVERFLOW | FE_UNDERFLOW)) || exceedsDigits(valueOf(m_operands.front())))
+    {
+        return std::nullopt;
+    }
+
+    // Division by zero is an error at any precision.
+    if (raised)
+    {
+        const std::string_view fault{ run(program, {}, true) };
+
+        if (!fault.empty())
         {
-            return std::string{ Word::error };
+            return fault;
         }
+    }
 
-        overflow = result.getSymbol() == Symbol::overflow;
+    return format(valueOf(m_operands.front()));
+}
 
-        m_tracelog.logCheckForOverflow(overflow);
-        if (overflow)
+// Returns the fault of the first instruction that raised a flag when locating,
+// an empty view otherwise.
+template <typename Trace, typename Number>
+std::string_view Evaluator<Trace, Number>::run(const Program& program, std::span<const Number> values, const bool locate,
+    const bool watchCancellation)
+{
+    Token* top{ m_operands.data() };
+    auto constant = program.constants().begin();
+
+    for (const OpCode operation : program.code())
+    {
+        if (locate)
         {
-			return std::string{ Word::overflow };
+            NumberTraits<Number>::clearFaults();
         }
 
-        underflow =  result.getSymbol() == Symbol::underflow;
+        switch (operation)
+        {
+        case OpCode::push:
+            *top++ = Token{ Symbol::none, *constant++ };
+            break;
 
-        m_tracelog.logCheckForUnderflow(underflow);
-        if (underflow)
+        case OpCode::pushPercentage:
+            *top++ = Token{ Symbol::percentage, *constant++ };
+            break;
+
+        case OpCode::load:
+            *top++ = Token{ Symbol::none, values[static_cast<std::size_t>(*constant++)] };
+            break;
+
+        case OpCode::loadNegative:
+            *top++ = Token{ Symbol::none, -values[static_cast<std::size_t>(*constant++)] };
+            break;
+
+        case OpCode::loadPercentage:
+            *top++ = Token{ Symbol::percentage, NumberTraits<Number>::percentage(values[static_cast<std::size_t>(*constant++)]) };
+            break;
+
+        case OpCode::negate:
+            *(top - 1) = Token{ Symbol::none, -valueOf(*(top - 1)) };
+            break;
+
+        default:
         {
-            return std::string{ Word::underflow };
+            const Token right{ *--top };
+            const Token left{ *--top };
+
+            const Number leftValue{ valueOf(left) };
+            Number rightValue{ right.getValue() };
+
+            // Exact types add or subtract a percentage as one multiplication
+            // by 100% plus or minus it, rounded once.
+            const bool percent{ right.getSymbol() == Symbol::percentage };
+            const bool applyOnce{ NumberTraits<Number>::exact && percent };
+
+            if (percent)
+            {
+                rightValue = NumberTraits<Number>::percentOf(leftValue, rightValue);
+            }
+
+            Number result{};
+
+            switch (operation)
+            {
+            case OpCode::add:
+                result = applyOnce
+                    ? NumberTraits<Number>::percentOf(leftValue, NumberTraits<Number>::percentage(Number{ 100 }) + right.getValue())
+                    : leftValue + rightValue;
+                m_cancelled |= watchCancellation && cancelled(result, leftValue, rightValue);
+                break;
+
+            case OpCode::subtract:
+                result = applyOnce
+                    ? NumberTraits<Number>::percentOf(leftValue, NumberTraits<Number>::percentage(Number{ 100 }) - right.getValue())
+                    : leftValue - rightValue;
+                m_cancelled |= watchCancellation && cancelled(result, leftValue, rightValue);
+                break;
+
+            case OpCode::multiply:
+                result = leftValue * rightValue;
+                break;
+
+            default:
+                result = leftValue / rightValue;
+                break;
+            }
+
+            if (!locate)
+            {
+                m_tracelog.logPerformArithmetic(static_cast<char>(operation),
+                    traceValue(leftValue), traceValue(rightValue), traceValue(result));
+            }
+
+            *top++ = Token{ Symbol::none, result };
+            break;
+        }
         }
 
-        stack.push(result);
-        queue.pop();
+        if (locate)
+        {
+            const std::string_view fault{ raisedFault() };
+
+            if (!fault.empty())
+            {
+                return fault;
+            }
+        }
     }
 
-    m_tracelog.logExpectOneToken(stack.size() == 1);
-    if (stack.size() != 1)
+    return {};
+}
+
+// Whether the result format shows more significant digits than Number holds.
+template <typename Trace, typename Number>
+bool Evaluator<Trace, Number>::exceedsDigits(const Number result) const
+{
+    if constexpr (NumberTraits<Number>::exact)
     {
-        return std::string{ Word::error };
+        return false;
     }
 
-    return trim(stack.top().getValue());
+    switch (m_format.style)
+    {
+    case ResultFormat::Style::shortest:
+        return false;
+
+    case ResultFormat::Style::significant:
+        return m_format.precision >= NumberTraits<Number>::digits10;
+
+    default:
+        return (result < 0 ? -result : result) >= m_fixedDigitsLimit;
+    }
 }
 
-std::string Evaluator::trim(const long double result)
+// A sum that is exactly zero is taken as exact, anything else far smaller
+// than its operands has lost the bits that set it apart from them.
+template <typename Trace, typename Number>
+bool Evaluator<Trace, Number>::cancelled(const Number result, const Number left, const Number right)
 {
-    std::string answer{ std::to_string(result) };
+    if constexpr (NumberTraits<Number>::exact)
+    {
+        return false;
+    }
+    else
+    {
+        constexpr Number scale{ static_cast<Number>(1 << cancellationBits) };
+
+        const Number largest{ std::max(left < 0 ? -left : left, right < 0 ? -right : right) };
+        return result != 0 && (result < 0 ? -result : result) * scale < largest;
+    }
+}
 
-    while (answer.back() == '0')
+// A percentage that is not applied to a left operand stands for its share of
+// one, which only exact types carry as something else.
+template <typename Trace, typename Number>
+Number Evaluator<Trace, Number>::valueOf(const Token& operand)
+{
+    if (operand.getSymbol() == Symbol::percentage)
     {
-        answer.pop_back();
-        m_tracelog.logTrimExtraZeroes(answer);
+        return NumberTraits<Number>::percentOf(Number{ 1 }, operand.getValue());
     }
 
-	bool wholeNumber{ answer.back() == '.' };
-    m_tracelog.logCheckForWholeNumber(wholeNumber);
-    if (wholeNumber)
+    return operand.getValue();
+}
+
+template <typename Trace, typename Number>
+std::string_view Evaluator<Trace, Number>::raisedFault()
+{
+    const int raised{ NumberTraits<Number>::faults() };
+
+    bool divideByZero{ (raised & (FE_DIVBYZERO | FE_INVALID)) != 0 };
+
+    m_tracelog.logCheckForDivideByZero(divideByZero);
+    if (divideByZero)
     {
-        answer.pop_back();
-        m_tracelog.logTrimDecimal(answer);
+        return Word::error;
     }
 
-    return answer;
+    bool overflow{ (raised & FE_OVERFLOW) != 0 };
+
+    m_tracelog.logCheckForOverflow(overflow);
+    if (overflow)
+    {
+        return Word::overflow;
+    }
+
+    bool underflow{ (raised & FE_UNDERFLOW) != 0 };
+
+    m_tracelog.logCheckForUnderflow(underflow);
+    if (underflow)
+    {
+        return Word::underflow;
+    }
+
+    return {};
 }
 
-Token Evaluator::doMath(const Token& mathOperator, const std::vector<Token>& operands)
+template <typename Trace, typename Number>
+std::string_view Evaluator<Trace, Number>::format(const Number result)
 {
-    m_tracelog.logCallingArithmeticOperation(mathOperator.getSymbol());
-    switch (mathOperator.getSymbol())
+    char* end{ formatResult(m_formatted.data(), m_formatted.data() + m_formatted.size(), result, m_format) };
+
+    // Only unbounded types can outgrow the buffer, it keeps the largest size.
+    while (!end && NumberTraits<Number>::unbounded)
+    {
+        m_formatted.resize(m_formatted.size() * 2);
+        end = formatResult(m_formatted.data(), m_formatted.data() + m_formatted.size(), result, m_format);
+    }
+
+    if (!end)
     {
-    case Symbol::add:
-        return performAddition(operands[1], operands[0]);
+        return Word::error;
+    }
+
+    const std::string_view answer{ m_formatted.data(), static_cast<std::size_t>(end - m_formatted.data()) };
+    m_tracelog.logFormatResult(answer);
 
-    case Symbol::subtract:
-        return performSubtraction(operands[1], operands[0]);
+    return answer;
+}
 
-    case Symbol::multiply:
-        return performMultiplication(operands[1], operands[0]);
+template <typename Trace, typename Number>
+typename Evaluator<Trace, Number>::Token Evaluator<Trace, Number>::doMath(const OpCode operation, const Token& left, const Token& right)
+{
+    m_tracelog.logCallingArithmeticOperation(static_cast<char>(operation));
+    switch (operation)
+    {
+    case OpCode::add:
+        return performAddition(left, right);
 
-    case Symbol::divide:
-        return performDivision(operands[1], operands[0]);
+    case OpCode::subtract:
+        return performSubtraction(left, right);
 
-    case Symbol::percent:
-        return mathOperator;
+    case OpCode::multiply:
+        return performMultiplication(left, right);
+
+    case OpCode::divide:
+        return performDivision(left, right);
 
     default:
-        return Token{ false, Symbol::invalid, 0.0 };
+        return Token{ Symbol::invalid, 0 };
     }
 }
 
-Token Evaluator::performAddition(const Token& left, const Token& right)
+template <typename Trace, typename Number>
+typename Evaluator<Trace, Number>::Token Evaluator<Trace, Number>::performAddition(const Token& left, const Token& right)
 {
-    long double leftValue{ left.getValue() };
-    long double rightValue{ right.getValue() };
+    Number leftValue{ left.getValue() };
+    Number rightValue{ right.getValue() };
 
-    bool percent{ right.getSymbol() == Symbol::percent };
+    bool percent{ right.getSymbol() == Symbol::percentage };
 
     m_tracelog.logCheckForPercentOperator(percent);
     if (percent)
@@ -206,24 +678,25 @@ Token Evaluator::performAddition(const Token& left, const Token& right)
         rightValue = percentResult.getValue();
     }
 
-    m_tracelog.logCheckForOverflow(std::numeric_limits<long double>::max() - leftValue < rightValue);
-    if (std::numeric_limits<long double>::max() - leftValue < rightValue)
+    m_tracelog.logCheckForOverflow(NumberTraits<Number>::max() - leftValue < rightValue);
+    if (NumberTraits<Number>::max() - leftValue < rightValue)
     {
-        return Token{ false, Symbol::overflow, std::numeric_limits<long double>::max() };
+        return Token{ Symbol::overflow, NumberTraits<Number>::max() };
     }
 
-    long double result{ leftValue + rightValue };
-	m_tracelog.logPerformArithmetic(Symbol::add, leftValue, rightValue, result);
+    Number result{ leftValue + rightValue };
+	m_tracelog.logPerformArithmetic(Symbol::add, traceValue(leftValue), traceValue(rightValue), traceValue(result));
 
-    return Token{ false, Symbol::none, result };
+    return Token{ Symbol::none, result };
 }
 
-Token Evaluator::performSubtraction(const Token& left, const Token& right)
+template <typename Trace, typename Number>
+typename Evaluator<Trace, Number>::Token Evaluator<Trace, Number>::performSubtraction(const Token& left, const Token& right)
 {
-    long double leftValue{ left.getValue() };
-    long double rightValue{ right.getValue() };
+    Number leftValue{ left.getValue() };
+    Number rightValue{ right.getValue() };
 
-    bool percent{ right.getSymbol() == Symbol::percent };
+    bool percent{ right.getSymbol() == Symbol::percentage };
 
     m_tracelog.logCheckForPercentOperator(percent);
     if (percent)
@@ -239,27 +712,28 @@ Token Evaluator::performSubtraction(const Token& left, const Token& right)
         rightValue = percentResult.getValue();
     }
 
-    bool overflow{ std::numeric_limits<long double>::lowest() + rightValue > leftValue};
+    bool overflow{ NumberTraits<Number>::lowest() + rightValue > leftValue};
 
     m_tracelog.logCheckForUnderflow(overflow);
     if (overflow)
     {
-        return Token{ false, Symbol::underflow, std::numeric_limits<long double>::lowest() };
+        return Token{ Symbol::underflow, NumberTraits<Number>::lowest() };
     }
 
-    long double result = leftValue - rightValue;
-	m_tracelog.logPerformArithmetic(Symbol::subtract, leftValue, rightValue, result);
+    Number result = leftValue - rightValue;
+	m_tracelog.logPerformArithmetic(Symbol::subtract, traceValue(leftValue), traceValue(rightValue), traceValue(result));
 
-    return Token{ false, Symbol::none, result };
+    return Token{ Symbol::none, result };
 }
 
-Token Evaluator::performMultiplication(const Token& left, const Token& right)
+template <typename Trace, typename Number>
+typename Evaluator<Trace, Number>::Token Evaluator<Trace, Number>::performMultiplication(const Token& left, const Token& right)
 {
-    long double leftValue{ left.getValue() };
-    long double rightValue{ right.getValue() };
+    Number leftValue{ left.getValue() };
+    Number rightValue{ right.getValue() };
 
-    m_tracelog.logCheckForPercentOperator(right.getSymbol() == Symbol::percent);
-    if (right.getSymbol() == Symbol::percent)
+    m_tracelog.logCheckForPercentOperator(right.getSymbol() == Symbol::percentage);
+    if (right.getSymbol() == Symbol::percentage)
     {
         Token percentResult{ performPercentage(right, left) };
         if (percentResult.getSymbol() == Symbol::overflow
@@ -271,27 +745,28 @@ Token Evaluator::performMultiplication(const Token& left, const Token& right)
         rightValue = percentResult.getValue();
     }
 
-    long double result{ leftValue * rightValue };
+    Number result{ leftValue * rightValue };
 
     bool overflow{ result / rightValue != leftValue };
 
     m_tracelog.logCheckForOverflow(overflow);
     if (overflow)
     {
-        return Token{ false, Symbol::overflow, std::numeric_limits<long double>::max() };
+        return Token{ Symbol::overflow, NumberTraits<Number>::max() };
     }
 
-	m_tracelog.logPerformArithmetic(Symbol::multiply, leftValue, rightValue, result);
-    return Token{ false, Symbol::none, result };
+	m_tracelog.logPerformArithmetic(Symbol::multiply, traceValue(leftValue), traceValue(rightValue), traceValue(result));
+    return Token{ Symbol::none, result };
 }
 
-Token Evaluator::performDivision(const Token& left, const Token& right)
+template <typename Trace, typename Number>
+typename Evaluator<Trace, Number>::Token Evaluator<Trace, Number>::performDivision(const Token& left, const Token& right)
 {
-    long double leftValue{ left.getValue() };
-    long double rightValue{ right.getValue() };
+    Number leftValue{ left.getValue() };
+    Number rightValue{ right.getValue() };
 
-    m_tracelog.logCheckForPercentOperator(right.getSymbol() == Symbol::percent);
-    if (right.getSymbol() == Symbol::percent)
+    m_tracelog.logCheckForPercentOperator(right.getSymbol() == Symbol::percentage);
+    if (right.getSymbol() == Symbol::percentage)
     {
         Token percentResult{ performPercentage(right, left) };
         if (percentResult.getSymbol() == Symbol::overflow
@@ -306,29 +781,30 @@ Token Evaluator::performDivision(const Token& left, const Token& right)
     m_tracelog.logCheckForDivideByZero(rightValue == 0);
     if (rightValue == 0)
     {
-        return Token{ false, Symbol::divideByZero, 0 };
+        return Token{ Symbol::divideByZero, 0 };
     }
 
-    long double result{ leftValue / rightValue };
+    Number result{ leftValue / rightValue };
 
     bool overflow{ result * rightValue != leftValue };
     
 	m_tracelog.logCheckForOverflow(overflow);
     if (overflow)
     {
-        return Token{ false, Symbol::overflow, std::numeric_limits<long double>::max() };
+        return Token{ Symbol::overflow, NumberTraits<Number>::max() };
     }
 
-    m_tracelog.logPerformArithmetic(Symbol::divide, leftValue, rightValue, result);
-    return Token{ false, Symbol::none, result };
+    m_tracelog.logPerformArithmetic(Symbol::divide, traceValue(leftValue), traceValue(rightValue), traceValue(result));
+    return Token{ Symbol::none, result };
 }
 
-Token Evaluator::performPercentage(const Token& percentage, const Token& left)
+template <typename Trace, typename Number>
+typename Evaluator<Trace, Number>::Token Evaluator<Trace, Number>::performPercentage(const Token& percentage, const Token& left)
 {
-    long double leftValue{ left.getValue() };
-    long double rightValue{ percentage.getValue() };
+    Number leftValue{ left.getValue() };
+    Number rightValue{ percentage.getValue() };
 
-    long double result{ leftValue * rightValue };
+    Number result{ leftValue * rightValue };
 
     bool overflow{ false };
     bool divideByZero{ rightValue == 0 };
@@ -342,9 +818,27 @@ Token Evaluator::performPercentage(const Token& percentage, const Token& left)
 	m_tracelog.logCheckForOverflow(overflow);
     if (overflow)
     {
-        return Token{ false, Symbol::overflow, std::numeric_limits<long double>::max() };
+        return Token{ Symbol::overflow, NumberTraits<Number>::max() };
     }
 
-    m_tracelog.logPercentArithmetic(percentage.getValue(), left.getValue(), result);
-    return Token{ false, Symbol::none, result };
+    m_tracelog.logPercentArithmetic(traceValue(percentage.getValue()), traceValue(left.getValue()), traceValue(result));
+    return Token{ Symbol::none, result };
 }
+
+template class Evaluator<Tracelog, double>;
+template class Evaluator<Tracelog, long double>;
+template class Evaluator<NoTrace, double>;
+template class Evaluator<NoTrace, long double>;
+
+#ifdef CALCULATOR_HAS_FLOAT128
+template class Evaluator<Tracelog, __float128>;
+template class Evaluator<NoTrace, __float128>;
+#endif
+
+#ifdef CALCULATOR_HAS_DECIMAL
+template class Evaluator<Tracelog, Decimal>;
+template class Evaluator<NoTrace, Decimal>;
+#endif
+
+template class Evaluator<Tracelog, BigDecimal>;
+template class Evaluator<NoTrace, BigDecimal>;
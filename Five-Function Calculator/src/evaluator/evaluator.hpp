@@ -2,34 +2,99 @@
 #define CALCULATOR_EVALUATOR_HPP
 
 #include "../enums/enums.hpp"
+#include "../format/resultFormat.hpp"
+#include "../number/numberTraits.hpp"
+#include "../program/program.hpp"
 #include "../token/token.hpp" 
+#include "../tracelog/noTrace.hpp"
 #include "../tracelog/tracelog.hpp"
 
-#include <limits>
+#include <algorithm>
 #include <cmath>
-#include <queue>
-#include <stack>
+#include <memory_resource>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
+// Same trace and number parameters as Tokenizer.
+template <typename Trace = Tracelog, typename Number = long double>
 class Evaluator
 {
 public:
-    Evaluator(Tracelog& tracelog);
+    using Token = ::Token<Number>;
+    using TokenStream = ::TokenStream<Number>;
+    using Program = ::Program<Number>;
+    using OpCode = typename Program::OpCode;
 
-    std::queue<Token> shunt(const std::vector<Token>& tokens);
-    std::string evaluate(std::queue<Token>& queue);
+    // Parentheses may nest this deep, a deeper expression is an ERROR.
+    static constexpr std::size_t maxNesting{ 1'000'000 };
+
+    // The operator stack of shunt(), the operand stack and the result buffer
+    // come from memory and keep their capacity between expressions.
+    Evaluator(Trace& tracelog, const OverflowCheck overflowCheck = OverflowCheck::perOperation,
+        const ResultFormat& format = {},
+        std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+
+    // Output streams and programs are supplied by the caller so their
+    // capacity is reused. shunt() produces the RPN that compile() validates
+    // and turns into a Program, shunt() and compile() take time and memory
+    // linear in the number of tokens at any nesting. evaluate() runs a Program without allocating
+    // once the operand stack has grown to the program's depth. A formula
+    // takes one value per placeholder, in Program::placeholders() order.
+    // Results are views of the evaluator's own buffer, valid until it
+    // evaluates again.
+    //
+    // With OverflowCheck::stickyFlags a raised FE_OVERFLOW reports OVERFLOW
+    // whatever the sign, FE_UNDERFLOW reports UNDERFLOW and FE_DIVBYZERO or
+    // FE_INVALID report ERROR, where the per-operation checks carry on with a
+    // zero quotient and 5/0 gives 0.
+    void shunt(const TokenStream& tokens, TokenStream& outputQueue);
+    void compile(const TokenStream& queue, Program& program);
+    std::string_view evaluate(const Program& program, std::span<const Number> values = {});
+
+    // For adaptive precision, runs an expression's program with the sticky
+    // flags and returns nothing when a wider type should take over: a literal
+    // or its negation is out of range, a flag other than FE_DIVBYZERO or
+    // FE_INVALID was raised, an addition or subtraction cancelled more than
+    // cancellationBits leading bits of its larger operand, or the result
+    // format would show more digits than Number holds. Any other error in the
+    // expression is the same in every type and is returned at once.
+    static constexpr int cancellationBits{ 20 };
+    std::optional<std::string_view> tryEvaluate(const Program& program);
 
 private:
-    Token doMath(const Token& mathOperator, const std::vector<Token>& operands);
+    template <typename, typename>
+    friend class StreamEvaluator;
+
+    Token doMath(const OpCode operation, const Token& left, const Token& right);
     Token performAddition(const Token& left, const Token& right);
 	Token performSubtraction(const Token& left, const Token& right);
 	Token performMultiplication(const Token& left, const Token& right);
 	Token performDivision(const Token& left, const Token& right);
     Token performPercentage(const Token& percentage, const Token& left);
-    std::string trim(const long double result);
+    std::string_view format(const Number result);
+
+    std::string_view evaluateWithFlags(const Program& program, std::span<const Number> values);
+    std::string_view run(const Program& program, std::span<const Number> values, const bool locate,
+        const bool watchCancellation = false);
+    static bool cancelled(const Number result, const Number left, const Number right);
+    static Number valueOf(const Token& operand);
+    bool exceedsDigits(const Number result) const;
+    std::string_view raisedFault();
+
+    Trace& m_tracelog;
+    OverflowCheck m_overflowCheck;
+    ResultFormat m_format;
+    std::pmr::vector<char> m_formatted;
+    std::pmr::vector<Token> m_operands;
+    std::pmr::vector<char> m_operators;
+    bool m_cancelled{ false };
 
-    Tracelog& m_tracelog;
+    // Smallest magnitude whose fixed format shows more digits than Number
+    // holds, unused by exact types.
+    Number m_fixedDigitsLimit{ 1 };
 };
 
 #endif
@@ -0,0 +1,556 @@
+#ifndef CALCULATOR_CONSTANT_FOLD_HPP
+#define CALCULATOR_CONSTANT_FOLD_HPP
+
+#include "../enums/enums.hpp"
+#include "../token/token.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+// Constant expressions folded by the compiler - tokenized, shunted and
+// evaluated with the same grammar as Tokenizer and Evaluator, without a
+// trace:
+//
+//   constexpr long double monthlyRate{ foldConstant("6.25/12/100") };
+//
+// foldConstant turns a fault into a compile error naming it, foldExpression
+// is the same code for run time callers and reports the fault instead.
+// Faults follow OverflowCheck::stickyFlags, tested from the results rather
+// than the floating point environment, which constant evaluation can't read.
+//
+// Literals are read exactly or not at all: digits, an optional decimal point
+// and digits, and an optional exponent, that fit the mantissa of Number and
+// scale by a power of ten it holds exactly, which covers rate tables. Other
+// literals are FoldFault::inexactLiteral rather than a result that could
+// differ from std::from_chars. That includes most large ones: double holds
+// powers of ten up to 1e22 exactly, so foldConstant<double>("1e300*1e300")
+// fails on its literals, not as an overflow.
+//
+// A minus sign before text that is not a number is FoldFault::invalid, where
+// the pipeline reads -0. calculator_fold_check compares both on edge cases.
+enum class FoldFault : char
+{
+    none,
+    invalid,
+    inexactLiteral,
+    overflow,
+    underflow,
+    divideByZero,
+};
+
+template <typename Number = long double>
+struct Folded
+{
+    Number value{ 0 };
+    FoldFault fault{ FoldFault::none };
+};
+
+// Word the pipeline shows for a fault, empty for FoldFault::none.
+constexpr std::string_view asWord(const FoldFault fault)
+{
+    switch (fault)
+    {
+    case FoldFault::none:
+        return {};
+
+    case FoldFault::overflow:
+        return Word::overflow;
+
+    case FoldFault::underflow:
+        return Word::underflow;
+
+    default:
+        return Word::error;
+    }
+}
+
+namespace FoldDetail
+{
+    template <typename Number>
+    constexpr Number magnitude(const Number value)
+    {
+        return value < 0 ? -value : value;
+    }
+
+    // Largest power of ten Number holds exactly, 5^n must fit its mantissa.
+    template <typename Number>
+    constexpr int exactPowerLimit()
+    {
+        Number mantissaLimit{ 1 };
+
+        for (int i = 0; i < std::numeric_limits<Number>::digits; ++i)
+        {
+            mantissaLimit *= 2;
+        }
+
+        Number power{ 1 };
+        int exponent{ 0 };
+
+        while (power * 5 < mantissaLimit)
+        {
+            power *= 5;
+            ++exponent;
+        }
+
+        return exponent;
+    }
+
+    template <typename Number>
+    constexpr Number powerOfTen(const int exponent)
+    {
+        Number power{ 1 };
+
+        for (int i = 0; i < exponent; ++i)
+        {
+            power *= 10;
+        }
+
+        return power;
+    }
+
+    constexpr bool isDigit(const char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    constexpr bool isOperatorSymbol(const char c)
+    {
+        return c == Symbol::add
+            || c == Symbol::subtract
+            || c == Symbol::multiply
+            || c == Symbol::divide
+            || c == Symbol::percent
+            || c == Symbol::openParenthesis
+            || c == Symbol::closeParenthesis;
+    }
+
+    // The longest prefix that is a number, as NumberTraits::parse reads it.
+    // The mantissa and the power of ten are both exact, so the one rounding
+    // that scales them gives the correctly rounded value.
+    template <typename Number>
+    constexpr FoldFault readNumber(const std::string_view text, Number& value)
+    {
+        constexpr int mantissaBits{ std::numeric_limits<Number>::digits };
+        constexpr std::uint64_t mantissaLimit{ mantissaBits < 64 ? std::uint64_t{ 1 } << mantissaBits : ~std::uint64_t{ 0 } };
+
+        std::uint64_t mantissa{ 0 };
+        int exponent{ 0 };
+        bool inexact{ false };
+        bool anyDigits{ false };
+        bool fraction{ false };
+        std::size_t pos{ 0 };
+
+        for (; pos < text.size(); ++pos)
+        {
+            const char c{ text[pos] };
+
+            if (c == Symbol::decimal && !fraction)
+            {
+                fraction = true;
+                continue;
+            }
+
+            if (!isDigit(c))
+            {
+                break;
+            }
+
+            anyDigits = true;
+            const std::uint64_t digit{ static_cast<std::uint64_t>(c - '0') };
+
+            // Digits past the mantissa only fit as trailing zeros.
+            if (mantissa > (mantissaLimit - digit) / 10)
+            {
+                inexact |= digit != 0;
+                exponent += fraction ? 0 : 1;
+                continue;
+            }
+
+            mantissa = mantissa * 10 + digit;
+            exponent -= fraction ? 1 : 0;
+        }
+
+        if (!anyDigits)
+        {
+            return FoldFault::invalid;
+        }
+
+        if (pos + 1 < text.size() && (text[pos] == 'e' || text[pos] == 'E') && isDigit(text[pos + 1]))
+        {
+            int written{ 0 };
+
+            for (++pos; pos < text.size() && isDigit(text[pos]); ++pos)
+            {
+                written = std::min(written * 10 + (text[pos] - '0'), 100'000);
+            }
+
+            exponent += written;
+        }
+
+        constexpr int limit{ exactPowerLimit<Number>() };
+
+        // 1e30 is 1e8 * 1e22, moving powers into the mantissa while it is
+        // still exact.
+        while (exponent > limit && mantissa && mantissa < mantissaLimit / 10)
+        {
+            mantissa *= 10;
+            --exponent;
+        }
+
+        if (inexact || (mantissa && (exponent > limit || exponent < -limit)))
+        {
+            return FoldFault::inexactLiteral;
+        }
+
+        value = static_cast<Number>(mantissa);
+        value = exponent < 0 ? value / powerOfTen<Number>(-exponent) : value * powerOfTen<Number>(exponent);
+        return FoldFault::none;
+    }
+
+    // Same single pass as Tokenizer::tokenize.
+    template <typename Number>
+    constexpr FoldFault tokenize(const std::string_view expression, std::vector<Token<Number>>& tokens)
+    {
+        std::size_t numStart{ 0 };
+        bool wasNumber{ false };
+        bool negate{ false };
+        bool afterOperator{ true };
+
+        for (std::size_t pos = 0; pos <= expression.size(); ++pos)
+        {
+            const bool atEnd{ pos == expression.size() };
+            const char c{ atEnd ? Symbol::none : expression[pos] };
+
+            if (!atEnd && !isOperatorSymbol(c))
+            {
+                if (!wasNumber)
+                {
+                    wasNumber = true;
+                    numStart = pos;
+                }
+
+                continue;
+            }
+
+            if (wasNumber)
+            {
+                wasNumber = false;
+
+                Number number{};
+                const FoldFault fault{ readNumber(expression.substr(numStart, pos - numStart), number) };
+
+                if (fault != FoldFault::none)
+                {
+                    return fault;
+                }
+
+                if (c == Symbol::percent && !negate)
+                {
+                    tokens.push_back(Token<Number>{ Symbol::percentage, number / 100 });
+                    afterOperator = true;
+                    continue;
+                }
+
+                tokens.push_back(Token<Number>{ Symbol::none, negate ? -number : number });
+                negate = false;
+                afterOperator = false;
+            }
+
+            if (atEnd)
+            {
+                break;
+            }
+
+            if (c == Symbol::subtract && afterOperator
+                && pos + 1 < expression.size() && !isOperatorSymbol(expression[pos + 1]))
+            {
+                negate = true;
+                continue;
+            }
+
+            if (c == Symbol::subtract && afterOperator
+                && pos + 1 < expression.size() && expression[pos + 1] == Symbol::openParenthesis)
+            {
+                tokens.push_back(Token<Number>{ Symbol::negative });
+                continue;
+            }
+
+            tokens.push_back(Token<Number>{ c });
+            afterOperator = c != Symbol::closeParenthesis;
+        }
+
+        return FoldFault::none;
+    }
+
+    // Shunting yard with parentheses, then the operand count checks of
+    // Evaluator::compile, so a malformed expression is invalid whatever its
+    // arithmetic would do.
+    template <typename Number>
+    constexpr FoldFault shunt(const std::vector<Token<Number>>& tokens, std::vector<Token<Number>>& queue)
+    {
+        std::vector<char> operators;
+
+        for (const Token<Number>& token : tokens)
+        {
+            if (!token.isOperator())
+            {
+                queue.push_back(token);
+                continue;
+            }
+
+            const char symbol{ token.getSymbol() };
+
+            if (symbol == Symbol::openParenthesis)
+            {
+                operators.push_back(symbol);
+                continue;
+            }
+
+            if (symbol == Symbol::closeParenthesis)
+            {
+                while (!operators.empty() && operators.back() != Symbol::openParenthesis)
+                {
+                    queue.push_back(Token<Number>{ operators.back() });
+                    operators.pop_back();
+                }
+
+                if (operators.empty())
+                {
+                    return FoldFault::invalid;
+                }
+
+                operators.pop_back();
+                continue;
+            }
+
+            while (symbol != Symbol::negative && !operators.empty() && operators.back() != Symbol::openParenthesis
+                && SymbolTraits::prescedence(operators.back()) >= token.getPrescedence())
+            {
+                queue.push_back(Token<Number>{ operators.back() });
+                operators.pop_back();
+            }
+
+            operators.push_back(symbol);
+        }
+
+        while (!operators.empty())
+        {
+            if (operators.back() == Symbol::openParenthesis)
+            {
+                return FoldFault::invalid;
+            }
+
+            queue.push_back(Token<Number>{ operators.back() });
+            operators.pop_back();
+        }
+
+        std::size_t depth{ 0 };
+
+        for (const Token<Number>& token : queue)
+        {
+            if (!token.isOperator())
+            {
+                ++depth;
+                continue;
+            }
+
+            const std::size_t operandCount{ static_cast<std::size_t>(token.getOperandCount()) };
+
+            if (!operandCount || depth < operandCount)
+            {
+                return FoldFault::invalid;
+            }
+
+            depth -= operandCount - 1;
+        }
+
+        return depth == 1 ? FoldFault::none : FoldFault::invalid;
+    }
+
+    // Faults as the sticky flags would raise them, found before the operation
+    // as constant evaluation stops at an infinite result. Tiny products are
+    // taken as inexact, sums that small are exact.
+    template <typename Number>
+    constexpr FoldFault fault(const char operation, const Number left, const Number right)
+    {
+        constexpr Number max{ std::numeric_limits<Number>::max() };
+        constexpr Number min{ std::numeric_limits<Number>::min() };
+
+        const Number a{ magnitude(left) };
+        const Number b{ magnitude(right) };
+        const bool negative{ (left < 0) != (right < 0) };
+
+        switch (operation)
+        {
+        case Symbol::add:
+            [[fallthrough]];
+        case Symbol::subtract:
+            if (negative == (operation == Symbol::subtract) && a > max - b)
+            {
+                return FoldFault::overflow;
+            }
+
+            return FoldFault::none;
+
+        case Symbol::multiply:
+            if (b > 1 && a > max / b)
+            {
+                return FoldFault::overflow;
+            }
+
+            return a != 0 && b != 0 && b < 1 && a < min / b ? FoldFault::underflow : FoldFault::none;
+
+        default:
+            if (b == 0)
+            {
+                return FoldFault::divideByZero;
+            }
+
+            if (b < 1 && a > max * b)
+            {
+                return FoldFault::overflow;
+            }
+
+            return a != 0 && b > 1 && a < min * b ? FoldFault::underflow : FoldFault::none;
+        }
+    }
+
+    template <typename Number>
+    constexpr FoldFault evaluate(const std::vector<Token<Number>>& queue, Number& value)
+    {
+        std::vector<Token<Number>> operands;
+
+        for (const Token<Number>& token : queue)
+        {
+            if (!token.isOperator())
+            {
+                operands.push_back(token);
+                continue;
+            }
+
+            if (token.getSymbol() == Symbol::negative)
+            {
+                operands.back() = Token<Number>{ Symbol::none, -operands.back().getValue() };
+                continue;
+            }
+
+            const Token<Number> right{ operands.back() };
+            operands.pop_back();
+            const Number left{ operands.back().getValue() };
+            operands.pop_back();
+
+            Number rightValue{ right.getValue() };
+
+            if (right.getSymbol() == Symbol::percentage)
+            {
+                if (const FoldFault raised{ fault(Symbol::multiply, rightValue, left) }; raised != FoldFault::none)
+                {
+                    return raised;
+                }
+
+                rightValue *= left;
+            }
+
+            if (const FoldFault raised{ fault(token.getSymbol(), left, rightValue) }; raised != FoldFault::none)
+            {
+                return raised;
+            }
+
+            Number result{};
+
+            switch (token.getSymbol())
+            {
+            case Symbol::add:
+                result = left + rightValue;
+                break;
+
+            case Symbol::subtract:
+                result = left - rightValue;
+                break;
+
+            case Symbol::multiply:
+                result = left * rightValue;
+                break;
+
+            default:
+                result = left / rightValue;
+                break;
+            }
+
+            operands.push_back(Token<Number>{ Symbol::none, result });
+        }
+
+        value = operands.front().getValue();
+        return FoldFault::none;
+    }
+
+    // Not constexpr, so reaching one while folding a constant stops the
+    // compiler with its name.
+    inline void constantExpressionIsInvalid() { }
+    inline void constantExpressionHasInexactLiteral() { }
+    inline void constantExpressionOverflows() { }
+    inline void constantExpressionUnderflows() { }
+    inline void constantExpressionDividesByZero() { }
+}
+
+template <typename Number = long double>
+constexpr Folded<Number> foldExpression(const std::string_view expression)
+{
+    std::vector<Token<Number>> tokens;
+    std::vector<Token<Number>> queue;
+    Folded<Number> folded;
+
+    folded.fault = FoldDetail::tokenize(expression, tokens);
+
+    if (folded.fault == FoldFault::none)
+    {
+        folded.fault = FoldDetail::shunt(tokens, queue);
+    }
+
+    if (folded.fault == FoldFault::none)
+    {
+        folded.fault = FoldDetail::evaluate(queue, folded.value);
+    }
+
+    return folded;
+}
+
+template <typename Number = long double>
+consteval Number foldConstant(const std::string_view expression)
+{
+    const Folded<Number> folded{ foldExpression<Number>(expression) };
+
+    switch (folded.fault)
+    {
+    case FoldFault::none:
+        break;
+
+    case FoldFault::inexactLiteral:
+        FoldDetail::constantExpressionHasInexactLiteral();
+        break;
+
+    case FoldFault::overflow:
+        FoldDetail::constantExpressionOverflows();
+        break;
+
+    case FoldFault::underflow:
+        FoldDetail::constantExpressionUnderflows();
+        break;
+
+    case FoldFault::divideByZero:
+        FoldDetail::constantExpressionDividesByZero();
+        break;
+
+    default:
+        FoldDetail::constantExpressionIsInvalid();
+        break;
+    }
+
+    return folded.value;
+}
+
+#endif
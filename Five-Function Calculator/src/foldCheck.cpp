@@ -0,0 +1,104 @@
+#include "engine/engine.hpp"
+#include "fold/constantFold.hpp"
+#include "format/resultFormat.hpp"
+#include "tracelog/noTrace.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// Checks the constant folder against the pipeline, at compile time for a few
+// constants and at run time for every edge case below, evaluated both by
+// foldExpression and by an Engine<NoTrace> with sticky flags.
+//
+//   calculator_fold_check
+//
+// Folding may refuse a literal the pipeline reads, see constantFold.hpp, but
+// any other result must be the same text. Exits with 1 on the first
+// expression that differs.
+
+static_assert(foldConstant("100+5%") == 105);
+static_assert(foldConstant("100-5%") == 95);
+static_assert(foldConstant("6.25/12/100") == 6.25L / 12 / 100);
+
+static_assert(foldConstant("(2+3)*4") == 20);
+static_assert(foldConstant("1-(2-(3-(4)))") == -2);
+static_assert(foldConstant("100+(5%)") == 105);
+static_assert(foldExpression("(1+2").fault == FoldFault::invalid);
+static_assert(foldExpression("1+2)").fault == FoldFault::invalid);
+static_assert(foldExpression("2(3)").fault == FoldFault::invalid);
+
+static_assert(foldConstant("3*-2") == -6);
+static_assert(foldConstant("3--2") == 5);
+static_assert(foldConstant("8/-(2)*3") == -12);
+static_assert(foldConstant("-(1+2)*-(3)") == 9);
+static_assert(foldExpression("--3").fault == FoldFault::invalid);
+
+static_assert(foldExpression("10/0").fault == FoldFault::divideByZero);
+static_assert(foldExpression<double>("1e300*1e300").fault == FoldFault::inexactLiteral);
+
+namespace
+{
+    constexpr std::string_view edgeCases[]{
+        "1+2", "100+5%", "5-3%", "-5%", "5%-3", "--3", "-abc", "2*3+4", "2+3*4", "10/4",
+        "10/0", "-4/0", "0/0", "1e308*10", "1e4000*1", "1.7976931348623157e308*2",
+        "-1.18973149535723176502e+4932", "0.1+0.2", "1/3", "123456789012345678901234567890",
+        "5%", "%", "-", "5-", "*5", "3*-2", "3--2", "1e-4950", "1e-4940*1e-10", "100*5%",
+        "100/5%", "100-5%", " 1 + 2", "1.5.5", "-0", "0.000001", "0.0000001",
+        "1000000000000000000000", "(2+3)*4", "2*(3+4)", "((1))", "-(2+3)", "8/-(2)*3",
+        "(1+2", "1+2)", "()", "2(3)", "(5%)", "100+(5%)", "-(-(-(1)))", "(1e300*1e300)",
+        "1e4000*1e-4000",
+    };
+
+    template <typename Number>
+    std::string format(const Folded<Number>& folded)
+    {
+        if (folded.fault != FoldFault::none)
+        {
+            return std::string{ asWord(folded.fault) };
+        }
+
+        std::array<char, formatBufferSize<Number>> buffer;
+        return { buffer.data(), formatResult(buffer.data(), buffer.data() + buffer.size(), folded.value) };
+    }
+
+    // Literals the folder can't read exactly, and negated ones that are not a
+    // number at all, are refused where the pipeline gives a result.
+    template <typename Number>
+    bool refused(const Folded<Number>& folded)
+    {
+        return folded.fault == FoldFault::inexactLiteral || folded.fault == FoldFault::invalid;
+    }
+
+    template <typename Number>
+    bool compare(const std::string_view typeName)
+    {
+        NoTrace noTrace;
+        EngineOptions options;
+        options.overflowCheck = OverflowCheck::stickyFlags;
+
+        Engine<NoTrace, Number> engine{ noTrace, nullptr, options };
+
+        for (const std::string_view expression : edgeCases)
+        {
+            const Folded<Number> folded{ foldExpression<Number>(expression) };
+            const std::string expected{ engine.evaluate(expression) };
+            const std::string actual{ format(folded) };
+
+            if (actual != expected && !(refused(folded) && expected != Word::error))
+            {
+                std::cerr << "FAILED: " << typeName << " \"" << expression << "\" folds to " << actual
+                    << ", the engine gives " << expected << '\n';
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    return compare<double>("double") && compare<long double>("long double") ? 0 : 1;
+}
@@ -0,0 +1,274 @@
+#include "resultFormat.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <string>
+
+// Drops trailing zeros after the decimal point, then the point itself.
+static char* trimZeroes(char* first, char* end)
+{
+    if (std::find(first, end, '.') == end)
+    {
+        return end;
+    }
+
+    while (end[-1] == '0')
+    {
+        --end;
+    }
+
+    if (end[-1] == '.')
+    {
+        --end;
+    }
+
+    return end;
+}
+
+template <typename Number>
+char* formatResult(char* first, char* last, const Number value, const ResultFormat& format)
+{
+    std::to_chars_result written;
+
+    switch (format.style)
+    {
+    case ResultFormat::Style::shortest:
+        written = std::to_chars(first, last, value);
+        break;
+
+    case ResultFormat::Style::significant:
+        written = std::to_chars(first, last, value, std::chars_format::general, format.precision);
+        break;
+
+    default:
+        written = std::to_chars(first, last, value, std::chars_format::fixed, format.precision);
+
+        if (written.ec == std::errc())
+        {
+            return trimZeroes(first, written.ptr);
+        }
+
+        break;
+    }
+
+    return written.ec == std::errc() ? written.ptr : nullptr;
+}
+
+template char* formatResult(char*, char*, const double, const ResultFormat&);
+template char* formatResult(char*, char*, const long double, const ResultFormat&);
+
+#ifdef CALCULATOR_HAS_FLOAT128
+// There is no std::to_chars for __float128 here, quadmath_snprintf stands in.
+// Shortest round trip tries one more significant digit at a time until the
+// text reads back as the same value.
+template <>
+char* formatResult(char* first, char* last, const __float128 value, const ResultFormat& format)
+{
+    const std::size_t size{ static_cast<std::size_t>(last - first) };
+    int length{ 0 };
+
+    switch (format.style)
+    {
+    case ResultFormat::Style::shortest:
+        for (int digits = 1; digits <= FLT128_DIG + 3; ++digits)
+        {
+            length = quadmath_snprintf(first, size, "%.*Qg", digits, value);
+
+            if (length < 0 || static_cast<std::size_t>(length) >= size
+                || strtoflt128(first, nullptr) == value || value != value)
+            {
+                break;
+            }
+        }
+
+        break;
+
+    case ResultFormat::Style::significant:
+        length = quadmath_snprintf(first, size, "%.*Qg", format.precision, value);
+        break;
+
+    default:
+        length = quadmath_snprintf(first, size, "%.*Qf", format.precision, value);
+
+        if (length >= 0 && static_cast<std::size_t>(length) < size)
+        {
+            return trimZeroes(first, first + length);
+        }
+
+        break;
+    }
+
+    if (length < 0 || static_cast<std::size_t>(length) >= size)
+    {
+        return nullptr;
+    }
+
+    return first + length;
+}
+#endif
+
+#ifdef CALCULATOR_HAS_DECIMAL
+template <>
+char* formatResult(char* first, char* last, const Decimal value, const ResultFormat& format)
+{
+    using Unsigned = unsigned __int128;
+
+    const Decimal::Units units{ value.units() };
+    Unsigned magnitude{ units < 0 ? -static_cast<Unsigned>(units) : static_cast<Unsigned>(units) };
+
+    int digitCount{ 1 };
+
+    for (Unsigned rest = magnitude / 10; rest; rest /= 10)
+    {
+        ++digitCount;
+    }
+
+    // Units dropped by rounding, a power of ten.
+    int dropped{ 0 };
+
+    switch (format.style)
+    {
+    case ResultFormat::Style::shortest:
+        break;
+
+    case ResultFormat::Style::significant:
+        dropped = std::max(digitCount - std::max(format.precision, 1), 0);
+        break;
+
+    default:
+        dropped = std::max(Decimal::scale() - format.precision, 0);
+        break;
+    }
+
+    if (dropped)
+    {
+        Unsigned divisor{ 1 };
+
+        for (int i = 0; i < dropped; ++i)
+        {
+            divisor *= 10;
+        }
+
+        const Unsigned remainder{ magnitude % divisor };
+        magnitude = magnitude / divisor;
+
+        if (remainder * 2 > divisor || (remainder * 2 == divisor
+            && (Decimal::rounding() == Decimal::Rounding::halfUp || (magnitude & 1))))
+        {
+            ++magnitude;
+        }
+    }
+
+    // Digits of the rounded magnitude, least significant first.
+    char digits[48];
+    int count{ 0 };
+
+    do
+    {
+        digits[count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+
+    // Negative when significant digits round off more than the scale.
+    const int decimals{ Decimal::scale() - dropped };
+    const int fraction{ std::max(decimals, 0) };
+    const int trailingZeros{ std::max(-decimals, 0) };
+    const int top{ std::max(count - 1, fraction) };
+    const bool negative{ units < 0 && (count > 1 || digits[0] != '0') };
+
+    if (last - first < negative + (top - fraction + 1) + trailingZeros + (fraction ? fraction + 1 : 0))
+    {
+        return nullptr;
+    }
+
+    char* out{ first };
+
+    if (negative)
+    {
+        *out++ = '-';
+    }
+
+    for (int i = top; i >= fraction; --i)
+    {
+        *out++ = i < count ? digits[i] : '0';
+    }
+
+    for (int i = 0; i < trailingZeros; ++i)
+    {
+        *out++ = '0';
+    }
+
+    if (fraction)
+    {
+        *out++ = '.';
+
+        for (int i = fraction - 1; i >= 0; --i)
+        {
+            *out++ = i < count ? digits[i] : '0';
+        }
+
+        out = trimZeroes(first, out);
+    }
+
+    return out;
+}
+#endif
+
+template <>
+char* formatResult(char* first, char* last, const BigDecimal value, const ResultFormat& format)
+{
+    BigDecimal rounded;
+
+    switch (format.style)
+    {
+    case ResultFormat::Style::shortest:
+        rounded = value;
+        break;
+
+    case ResultFormat::Style::significant:
+    {
+        const long digitCount{ static_cast<long>(value.coefficient().digitCount()) };
+        rounded = value.roundedTo(static_cast<long>(value.scale()) - digitCount + std::max(format.precision, 1));
+        break;
+    }
+
+    default:
+        rounded = value.roundedTo(format.precision);
+        break;
+    }
+
+    const std::string digits{ rounded.coefficient().magnitudeDigits() };
+    const std::size_t scale{ rounded.scale() };
+    const bool negative{ rounded.coefficient().isNegative() };
+    const std::size_t whole{ digits.size() > scale ? digits.size() - scale : 1 };
+
+    if (static_cast<std::size_t>(last - first) < negative + whole + (scale ? scale + 1 : 0))
+    {
+        return nullptr;
+    }
+
+    char* out{ first };
+
+    if (negative)
+    {
+        *out++ = '-';
+    }
+
+    if (digits.size() > scale)
+    {
+        out = std::copy_n(digits.data(), whole, out);
+    }
+    else
+    {
+        *out++ = '0';
+    }
+
+    if (scale)
+    {
+        *out++ = '.';
+        out = std::fill_n(out, scale - std::min(scale, digits.size()), '0');
+        out = std::copy(digits.end() - static_cast<std::ptrdiff_t>(std::min(scale, digits.size())), digits.end(), out);
+    }
+
+    return out;
+}
@@ -0,0 +1,57 @@
+#ifndef CALCULATOR_RESULT_FORMAT_HPP
+#define CALCULATOR_RESULT_FORMAT_HPP
+
+#include "../number/numberTraits.hpp"
+
+#include <cstddef>
+
+// How results are written. fixed is the calculator's own style, precision
+// decimals with trailing zeros and a bare decimal point removed - six, as
+// std::to_string wrote them, by default. shortest writes the fewest digits
+// that read back as the same value, significant rounds to precision
+// significant digits.
+struct ResultFormat
+{
+    enum class Style : char
+    {
+        fixed,
+        shortest,
+        significant,
+    };
+
+    Style style{ Style::fixed };
+    int precision{ 6 };
+};
+
+// Largest precision a buffer of formatBufferSize is guaranteed to hold.
+constexpr int maxFormatPrecision{ 40 };
+
+// Fits any value in any format, including the hundreds or thousands of
+// integer digits fixed notation gives the largest values.
+template <typename Number>
+constexpr std::size_t formatBufferSize{
+    static_cast<std::size_t>(NumberTraits<Number>::maxExponent10) + maxFormatPrecision + 8 };
+
+// Writes value into [first, last) without allocating. Returns one past the
+// last character written, or nullptr when the buffer is too small.
+template <typename Number>
+char* formatResult(char* first, char* last, const Number value, const ResultFormat& format = {});
+
+#ifdef CALCULATOR_HAS_FLOAT128
+template <>
+char* formatResult(char* first, char* last, const __float128 value, const ResultFormat& format);
+#endif
+
+// Decimals are written exactly, without an exponent, and fixed and
+// significant rounding follows Decimal::rounding().
+#ifdef CALCULATOR_HAS_DECIMAL
+template <>
+char* formatResult(char* first, char* last, const Decimal value, const ResultFormat& format);
+#endif
+
+// Big decimals are written exactly too, rounding half to even, and may need a
+// buffer larger than formatBufferSize.
+template <>
+char* formatResult(char* first, char* last, const BigDecimal value, const ResultFormat& format);
+
+#endif
@@ -0,0 +1,76 @@
+#include "lineScanner.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CALCULATOR_SSE2_NEWLINES
+#include <emmintrin.h>
+#endif
+
+const char* findNewline(const char* first, const char* last)
+{
+#ifdef CALCULATOR_SSE2_NEWLINES
+    const __m128i newline{ _mm_set1_epi8('\n') };
+
+    // Unaligned loads, only while 16 bytes remain so nothing past the end of
+    // a mapping is touched.
+    for (; last - first >= 16; first += 16)
+    {
+        const __m128i bytes{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(first)) };
+        const unsigned matches{ static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newline))) };
+
+        if (matches)
+        {
+            return first + std::countr_zero(matches);
+        }
+    }
+#endif
+
+    const void* found{ first < last ? std::memchr(first, '\n', static_cast<std::size_t>(last - first)) : nullptr };
+    return found ? static_cast<const char*>(found) : last;
+}
+
+bool takeLine(std::string_view& text, std::string_view& line)
+{
+    if (text.empty())
+    {
+        return false;
+    }
+
+    const char* end{ text.data() + text.size() };
+    const char* newline{ findNewline(text.data(), end) };
+
+    line = { text.data(), static_cast<std::size_t>(newline - text.data()) };
+    text.remove_prefix(line.size() + (newline != end ? 1 : 0));
+
+    // Tolerate files saved with Windows line endings.
+    if (!line.empty() && line.back() == '\r')
+    {
+        line.remove_suffix(1);
+    }
+
+    return true;
+}
+
+std::vector<std::string_view> splitLines(const std::string_view text, const std::size_t parts)
+{
+    std::vector<std::string_view> ranges;
+
+    const char* const end{ text.data() + text.size() };
+    const char* first{ text.data() };
+    const std::size_t step{ text.size() / std::max<std::size_t>(parts, 1) + 1 };
+
+    while (first != end)
+    {
+        const char* target{ first + std::min<std::size_t>(step, static_cast<std::size_t>(end - first)) };
+        const char* last{ target == end ? end : findNewline(target - 1, end) };
+
+        last = last == end ? end : last + 1;
+        ranges.emplace_back(first, static_cast<std::size_t>(last - first));
+        first = last;
+    }
+
+    return ranges;
+}
@@ -0,0 +1,24 @@
+#ifndef CALCULATOR_LINE_SCANNER_HPP
+#define CALCULATOR_LINE_SCANNER_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+// Newline scanning over text already in memory, such as a MappedFile. Lines
+// are views into the text, never copies.
+
+// The first '\n' in [first, last), or last when there is none. Compares 16
+// bytes at a time with SSE2 where the target has it, memchr elsewhere.
+const char* findNewline(const char* first, const char* last);
+
+// Takes the first line off the front of text, without its newline or a '\r'
+// before that, as std::getline would read it. Returns false once text is
+// empty.
+bool takeLine(std::string_view& text, std::string_view& line);
+
+// Cuts text into at most parts ranges of roughly equal size, each one ending
+// just after a newline or at the end of the text, so no line is split.
+std::vector<std::string_view> splitLines(const std::string_view text, const std::size_t parts);
+
+#endif
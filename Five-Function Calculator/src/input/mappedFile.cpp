@@ -0,0 +1,111 @@
+#include "mappedFile.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::filesystem::path& filePath)
+{
+    HANDLE file{ CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    LARGE_INTEGER size{};
+
+    if (GetFileType(file) == FILE_TYPE_DISK && GetFileSizeEx(file, &size))
+    {
+        m_size = static_cast<std::size_t>(size.QuadPart);
+
+        // An empty file can't be mapped, and needs no mapping.
+        m_good = m_size == 0;
+
+        if (m_size)
+        {
+            m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+            if (m_mapping)
+            {
+                m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+                m_good = m_data != nullptr;
+            }
+        }
+    }
+
+    // The mapping keeps the file open.
+    CloseHandle(file);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+
+    if (m_mapping)
+    {
+        CloseHandle(m_mapping);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& filePath)
+{
+    const int file{ open(filePath.c_str(), O_RDONLY) };
+
+    if (file < 0)
+    {
+        return;
+    }
+
+    struct stat status{};
+
+    if (fstat(file, &status) == 0 && S_ISREG(status.st_mode))
+    {
+        m_size = static_cast<std::size_t>(status.st_size);
+
+        // An empty file can't be mapped, and needs no mapping.
+        m_good = m_size == 0;
+
+        if (m_size)
+        {
+            void* data{ mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0) };
+
+            if (data != MAP_FAILED)
+            {
+                // Lines are read front to back, once.
+                madvise(data, m_size, MADV_SEQUENTIAL);
+
+                m_data = static_cast<const char*>(data);
+                m_good = true;
+            }
+        }
+    }
+
+    // The mapping keeps the file open.
+    close(file);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+    {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+}
+
+#endif
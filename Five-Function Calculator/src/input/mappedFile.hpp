@@ -0,0 +1,34 @@
+#ifndef CALCULATOR_MAPPED_FILE_HPP
+#define CALCULATOR_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+// A whole file mapped read-only into memory, so its lines can be handed out
+// as views without reading them into strings. Unmapped on destruction. Files
+// that can't be mapped, such as pipes, leave good() false and the caller
+// reads them as a stream instead.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::filesystem::path& filePath);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool good() const { return m_good; }
+    std::string_view contents() const { return { m_data, m_size }; }
+
+private:
+    const char* m_data{ nullptr };
+    std::size_t m_size{ 0 };
+    bool m_good{ false };
+
+#ifdef _WIN32
+    void* m_mapping{ nullptr };
+#endif
+};
+
+#endif
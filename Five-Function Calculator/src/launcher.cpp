@@ -2,6 +2,8 @@
 
 #include <wx/wx.h>
 
+#include <cstddef>
+
 class Launcher : public wxApp
 {
 public:
@@ -10,8 +12,21 @@ public:
 
 bool Launcher::OnInit()
 {
+    // Optional "--trace-capacity N" sets how many entries the Trace Logic tab keeps.
+    std::size_t traceCapacity{ defaultTraceCapacity };
+
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        unsigned long value{ 0 };
+
+        if (argv[i] == "--trace-capacity" && argv[i + 1].ToULong(&value) && value > 0)
+        {
+            traceCapacity = value;
+        }
+    }
+
     Application* appWindow{ new Application(
-        "Five-Function Calculator", "./CalcTrace.txt")};
+        "Five-Function Calculator", "./CalcTrace.txt", traceCapacity)};
 
     appWindow->Show();
     return true;
@@ -0,0 +1,24 @@
+#include "countingResource.hpp"
+
+CountingResource::CountingResource(std::pmr::memory_resource* upstream)
+    : m_upstream{ upstream }
+{ }
+
+void* CountingResource::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    void* pointer{ m_upstream->allocate(bytes, alignment) };
+
+    ++m_allocations;
+    m_bytes += bytes;
+    return pointer;
+}
+
+void CountingResource::do_deallocate(void* pointer, const std::size_t bytes, const std::size_t alignment)
+{
+    m_upstream->deallocate(pointer, bytes, alignment);
+}
+
+bool CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
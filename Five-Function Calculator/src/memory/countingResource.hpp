@@ -0,0 +1,29 @@
+#ifndef CALCULATOR_COUNTING_RESOURCE_HPP
+#define CALCULATOR_COUNTING_RESOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+// Passes every request on to its upstream resource, counting the allocations
+// and bytes that reach it. Not synchronized, like the pool an engine puts in
+// front of it.
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+    std::uint64_t allocations() const { return m_allocations; }
+    std::uint64_t bytes() const { return m_bytes; }
+
+private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override;
+    void do_deallocate(void* pointer, const std::size_t bytes, const std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    std::pmr::memory_resource* m_upstream;
+    std::uint64_t m_allocations{ 0 };
+    std::uint64_t m_bytes{ 0 };
+};
+
+#endif
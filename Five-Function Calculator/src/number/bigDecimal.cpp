@@ -0,0 +1,200 @@
+#include "bigDecimal.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+BigDecimal::BigDecimal(BigInteger coefficient, const std::size_t scale)
+    : m_coefficient{ std::move(coefficient) },
+    m_scale{ scale }
+{
+    normalize();
+}
+
+bool BigDecimal::parse(const std::string_view text, BigDecimal& value)
+{
+    std::size_t position{ 0 };
+    std::string digits;
+
+    const auto isDigit = [&](const std::size_t at) {
+        return at < text.size() && text[at] >= '0' && text[at] <= '9';
+    };
+
+    while (isDigit(position))
+    {
+        digits += text[position++];
+    }
+
+    std::size_t fractionDigits{ 0 };
+
+    if (position < text.size() && text[position] == '.')
+    {
+        ++position;
+
+        while (isDigit(position))
+        {
+            digits += text[position++];
+            ++fractionDigits;
+        }
+    }
+
+    BigInteger coefficient;
+
+    if (!BigInteger::parse(digits, coefficient))
+    {
+        return false;
+    }
+
+    std::size_t exponent{ 0 };
+
+    if (position < text.size() && (text[position] == 'e' || text[position] == 'E'))
+    {
+        std::size_t at{ position + 1 };
+
+        if (at < text.size() && text[at] == '+')
+        {
+            ++at;
+        }
+
+        while (isDigit(at))
+        {
+            exponent = std::min(exponent * 10 + static_cast<std::size_t>(text[at++] - '0'), maxExponent + 1);
+        }
+    }
+
+    if (exponent > maxExponent && !coefficient.isZero())
+    {
+        return false;
+    }
+
+    if (exponent > fractionDigits)
+    {
+        value = BigDecimal{ coefficient * BigInteger::powerOfTen(exponent - fractionDigits), 0 };
+    }
+    else
+    {
+        value = BigDecimal{ std::move(coefficient), fractionDigits - exponent };
+    }
+
+    return true;
+}
+
+BigDecimal BigDecimal::roundedTo(const long decimals) const
+{
+    if (decimals >= 0 && m_scale <= static_cast<std::size_t>(decimals))
+    {
+        return *this;
+    }
+
+    const BigInteger divisor{ BigInteger::powerOfTen(static_cast<std::size_t>(static_cast<long>(m_scale) - decimals)) };
+    BigInteger quotient;
+    BigInteger remainder;
+    BigInteger::divide(m_coefficient, divisor, quotient, remainder);
+
+    const std::strong_ordering half{ BigInteger::compareMagnitude(remainder + remainder, divisor) };
+
+    if (half > 0 || (half == 0 && quotient.isOdd()))
+    {
+        quotient = quotient + BigInteger{ m_coefficient.isNegative() ? -1 : 1 };
+    }
+
+    if (decimals < 0)
+    {
+        return BigDecimal{ quotient * BigInteger::powerOfTen(static_cast<std::size_t>(-decimals)), 0 };
+    }
+
+    return BigDecimal{ std::move(quotient), static_cast<std::size_t>(decimals) };
+}
+
+long double BigDecimal::toLongDouble() const
+{
+    return m_coefficient.toLongDouble() / std::pow(10.0L, static_cast<long double>(m_scale));
+}
+
+BigDecimal operator+(const BigDecimal& left, const BigDecimal& right)
+{
+    const std::size_t scale{ std::max(left.m_scale, right.m_scale) };
+    return BigDecimal{ left.coefficientAt(scale) + right.coefficientAt(scale), scale };
+}
+
+BigDecimal operator-(const BigDecimal& left, const BigDecimal& right)
+{
+    const std::size_t scale{ std::max(left.m_scale, right.m_scale) };
+    return BigDecimal{ left.coefficientAt(scale) - right.coefficientAt(scale), scale };
+}
+
+BigDecimal operator*(const BigDecimal& left, const BigDecimal& right)
+{
+    return BigDecimal{ left.m_coefficient * right.m_coefficient, left.m_scale + right.m_scale };
+}
+
+BigDecimal operator/(const BigDecimal& left, const BigDecimal& right)
+{
+    if (right.m_coefficient.isZero())
+    {
+        BigDecimal::t_faults |= FE_DIVBYZERO;
+        return BigDecimal{};
+    }
+
+    // (l / 10^a) / (r / 10^b) to scale s is l * 10^(s - a + b) / r.
+    const std::size_t scale{ std::max(left.m_scale, right.m_scale) + BigDecimal::divisionDigits };
+
+    BigInteger quotient;
+    BigInteger remainder;
+    BigInteger::divide(left.m_coefficient * BigInteger::powerOfTen(scale - left.m_scale + right.m_scale),
+        right.m_coefficient, quotient, remainder);
+
+    const std::strong_ordering half{ BigInteger::compareMagnitude(remainder + remainder, right.m_coefficient) };
+
+    if (half > 0 || (half == 0 && quotient.isOdd()))
+    {
+        const bool negative{ left.m_coefficient.isNegative() != right.m_coefficient.isNegative() };
+        quotient = quotient + BigInteger{ negative ? -1 : 1 };
+    }
+
+    return BigDecimal{ std::move(quotient), scale };
+}
+
+BigDecimal BigDecimal::operator-() const
+{
+    BigDecimal negated{ *this };
+    negated.m_coefficient = -m_coefficient;
+    return negated;
+}
+
+std::strong_ordering operator<=>(const BigDecimal& left, const BigDecimal& right)
+{
+    const std::size_t scale{ std::max(left.m_scale, right.m_scale) };
+    return left.coefficientAt(scale) <=> right.coefficientAt(scale);
+}
+
+BigInteger BigDecimal::coefficientAt(const std::size_t scale) const
+{
+    if (scale == m_scale)
+    {
+        return m_coefficient;
+    }
+
+    return m_coefficient * BigInteger::powerOfTen(scale - m_scale);
+}
+
+void BigDecimal::normalize()
+{
+    if (m_coefficient.isZero())
+    {
+        m_scale = 0;
+        return;
+    }
+
+    while (m_scale)
+    {
+        BigInteger rest{ m_coefficient };
+
+        if (rest.divideSmall(10) != 0)
+        {
+            break;
+        }
+
+        m_coefficient = std::move(rest);
+        --m_scale;
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef CALCULATOR_BIG_DECIMAL_HPP
+#define CALCULATOR_BIG_DECIMAL_HPP
+
+#include "bigInteger.hpp"
+
+#include <cfenv>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+// Arbitrary-precision decimal, coefficient * 10^-scale, the fallback engine
+// for results out of range of the fixed width types. Literals, sums,
+// differences and products are exact, quotients keep divisionDigits more
+// decimals than their operands and round half to even. Values are kept
+// without trailing fractional zeros.
+//
+// Like Decimal, division by zero raises FE_DIVBYZERO in a per-thread set read
+// by faults(), nothing else can fail.
+class BigDecimal
+{
+public:
+    static constexpr std::size_t divisionDigits{ 32 };
+
+    // Literal exponents past this are rejected rather than expanded.
+    static constexpr std::size_t maxExponent{ 100'000 };
+
+    static void clearFaults() { t_faults = 0; }
+    static int faults() { return t_faults; }
+
+    // Same literal rules as Decimal::parse.
+    static bool parse(const std::string_view text, BigDecimal& value);
+
+    BigDecimal() = default;
+    BigDecimal(BigInteger coefficient, const std::size_t scale);
+
+    template <std::integral Integer>
+    BigDecimal(const Integer whole)
+        : m_coefficient{ static_cast<std::int64_t>(whole) }
+    { }
+
+    const BigInteger& coefficient() const { return m_coefficient; }
+    std::size_t scale() const { return m_scale; }
+
+    // Rounds half to even to at most decimals fractional digits, a negative
+    // count rounds to tens, hundreds and so on.
+    BigDecimal roundedTo(const long decimals) const;
+
+    // Through long double, integer types truncate toward zero.
+    template <typename Arithmetic>
+        requires std::is_arithmetic_v<Arithmetic>
+    explicit operator Arithmetic() const
+    {
+        return static_cast<Arithmetic>(toLongDouble());
+    }
+
+    long double toLongDouble() const;
+
+    friend BigDecimal operator+(const BigDecimal& left, const BigDecimal& right);
+    friend BigDecimal operator-(const BigDecimal& left, const BigDecimal& right);
+    friend BigDecimal operator*(const BigDecimal& left, const BigDecimal& right);
+    friend BigDecimal operator/(const BigDecimal& left, const BigDecimal& right);
+
+    BigDecimal operator-() const;
+    BigDecimal& operator*=(const BigDecimal& right) { return *this = *this * right; }
+
+    friend bool operator==(const BigDecimal& left, const BigDecimal& right) = default;
+    friend std::strong_ordering operator<=>(const BigDecimal& left, const BigDecimal& right);
+
+private:
+    // Coefficient scaled up to the given scale, at least the current one.
+    BigInteger coefficientAt(const std::size_t scale) const;
+    void normalize();
+
+    static inline thread_local int t_faults{ 0 };
+
+    BigInteger m_coefficient;
+    std::size_t m_scale{ 0 };
+};
+
+#endif
@@ -0,0 +1,535 @@
+#include "bigInteger.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace
+{
+    using Limb = BigInteger::Limb;
+    using Limbs = BigInteger::Limbs;
+
+    constexpr Limb decimalChunk{ 1'000'000'000 };
+    constexpr int decimalChunkDigits{ 9 };
+
+    void trim(Limbs& limbs)
+    {
+        while (!limbs.empty() && limbs.back() == 0)
+        {
+            limbs.pop_back();
+        }
+    }
+
+    std::strong_ordering compare(const Limb* left, std::size_t leftSize, const Limb* right, std::size_t rightSize)
+    {
+        if (leftSize != rightSize)
+        {
+            return leftSize <=> rightSize;
+        }
+
+        for (std::size_t i = leftSize; i-- > 0;)
+        {
+            if (left[i] != right[i])
+            {
+                return left[i] <=> right[i];
+            }
+        }
+
+        return std::strong_ordering::equal;
+    }
+
+    // target += value << (32 * shift), target grows as needed.
+    void addShifted(Limbs& target, const Limb* value, const std::size_t size, const std::size_t shift)
+    {
+        if (target.size() < shift + size + 1)
+        {
+            target.resize(shift + size + 1, 0);
+        }
+
+        std::uint64_t carry{ 0 };
+        std::size_t i{ 0 };
+
+        for (; i < size; ++i)
+        {
+            const std::uint64_t sum{ static_cast<std::uint64_t>(target[shift + i]) + value[i] + carry };
+            target[shift + i] = static_cast<Limb>(sum);
+            carry = sum >> 32;
+        }
+
+        for (std::size_t at = shift + i; carry; ++at)
+        {
+            if (at == target.size())
+            {
+                target.push_back(0);
+            }
+
+            const std::uint64_t sum{ static_cast<std::uint64_t>(target[at]) + carry };
+            target[at] = static_cast<Limb>(sum);
+            carry = sum >> 32;
+        }
+    }
+
+    // target -= value, target must not be smaller.
+    void subtractInPlace(Limbs& target, const Limb* value, const std::size_t size)
+    {
+        std::int64_t borrow{ 0 };
+
+        for (std::size_t i = 0; i < target.size() && (i < size || borrow); ++i)
+        {
+            std::int64_t difference{ static_cast<std::int64_t>(target[i]) - borrow - (i < size ? value[i] : 0) };
+            borrow = difference < 0;
+            target[i] = static_cast<Limb>(difference + (borrow << 32));
+        }
+
+        trim(target);
+    }
+
+    Limbs add(const Limbs& left, const Limbs& right)
+    {
+        Limbs sum{ left };
+        addShifted(sum, right.data(), right.size(), 0);
+        trim(sum);
+        return sum;
+    }
+
+    void schoolbook(const Limb* left, const std::size_t leftSize, const Limb* right, const std::size_t rightSize, Limb* product)
+    {
+        std::fill_n(product, leftSize + rightSize, 0);
+
+        for (std::size_t i = 0; i < leftSize; ++i)
+        {
+            std::uint64_t carry{ 0 };
+
+            for (std::size_t j = 0; j < rightSize; ++j)
+            {
+                const std::uint64_t term{ static_cast<std::uint64_t>(left[i]) * right[j] + product[i + j] + carry };
+                product[i + j] = static_cast<Limb>(term);
+                carry = term >> 32;
+            }
+
+            product[i + rightSize] = static_cast<Limb>(carry);
+        }
+    }
+
+    Limbs multiply(const Limb* left, std::size_t leftSize, const Limb* right, std::size_t rightSize);
+
+    // Both operands half or more of the split size.
+    Limbs karatsuba(const Limb* left, const std::size_t leftSize, const Limb* right, const std::size_t rightSize)
+    {
+        const std::size_t half{ std::max(leftSize, rightSize) / 2 };
+
+        const std::size_t left0Size{ std::min(half, leftSize) };
+        const std::size_t right0Size{ std::min(half, rightSize) };
+
+        Limbs left0(left, left + left0Size);
+        Limbs right0(right, right + right0Size);
+        trim(left0);
+        trim(right0);
+
+        const Limbs left1(left + left0Size, left + leftSize);
+        const Limbs right1(right + right0Size, right + rightSize);
+
+        const Limbs low{ multiply(left0.data(), left0.size(), right0.data(), right0.size()) };
+        const Limbs high{ multiply(left1.data(), left1.size(), right1.data(), right1.size()) };
+
+        const Limbs leftSum{ add(left0, left1) };
+        const Limbs rightSum{ add(right0, right1) };
+        Limbs middle{ multiply(leftSum.data(), leftSum.size(), rightSum.data(), rightSum.size()) };
+        subtractInPlace(middle, low.data(), low.size());
+        subtractInPlace(middle, high.data(), high.size());
+
+        Limbs product(leftSize + rightSize + 1, 0);
+        addShifted(product, low.data(), low.size(), 0);
+        addShifted(product, middle.data(), middle.size(), half);
+        addShifted(product, high.data(), high.size(), 2 * half);
+        trim(product);
+
+        return product;
+    }
+
+    Limbs multiply(const Limb* left, std::size_t leftSize, const Limb* right, std::size_t rightSize)
+    {
+        if (leftSize == 0 || rightSize == 0)
+        {
+            return {};
+        }
+
+        if (leftSize < rightSize)
+        {
+            std::swap(left, right);
+            std::swap(leftSize, rightSize);
+        }
+
+        if (rightSize < BigInteger::karatsubaThreshold)
+        {
+            Limbs product(leftSize + rightSize);
+            schoolbook(left, leftSize, right, rightSize, product.data());
+            trim(product);
+            return product;
+        }
+
+        // Lopsided operands are cut into balanced pieces of the shorter one.
+        if (leftSize >= 2 * rightSize)
+        {
+            Limbs product(leftSize + rightSize + 1, 0);
+
+            for (std::size_t at = 0; at < leftSize; at += rightSize)
+            {
+                const std::size_t size{ std::min(rightSize, leftSize - at) };
+                const Limbs piece{ multiply(left + at, size, right, rightSize) };
+                addShifted(product, piece.data(), piece.size(), at);
+            }
+
+            trim(product);
+            return product;
+        }
+
+        return karatsuba(left, leftSize, right, rightSize);
+    }
+
+    // Knuth's algorithm D, the divisor has at least two limbs and the
+    // dividend at least as many.
+    void divideLong(const Limbs& dividend, const Limbs& divisor, Limbs& quotient, Limbs& remainder)
+    {
+        const std::size_t n{ divisor.size() };
+        const std::size_t m{ dividend.size() - n };
+        const int shift{ std::countl_zero(divisor.back()) };
+
+        // Normalized so the divisor's top limb has its high bit set.
+        Limbs v(n);
+        Limbs u(dividend.size() + 1);
+
+        for (std::size_t i = n - 1; i > 0; --i)
+        {
+            v[i] = shift ? (divisor[i] << shift) | (divisor[i - 1] >> (32 - shift)) : divisor[i];
+        }
+
+        v[0] = divisor[0] << shift;
+        u[m + n] = shift ? dividend[m + n - 1] >> (32 - shift) : 0;
+
+        for (std::size_t i = m + n - 1; i > 0; --i)
+        {
+            u[i] = shift ? (dividend[i] << shift) | (dividend[i - 1] >> (32 - shift)) : dividend[i];
+        }
+
+        u[0] = dividend[0] << shift;
+
+        constexpr std::uint64_t base{ std::uint64_t{ 1 } << 32 };
+        quotient.assign(m + 1, 0);
+
+        for (std::size_t j = m + 1; j-- > 0;)
+        {
+            const std::uint64_t numerator{ (static_cast<std::uint64_t>(u[j + n]) << 32) | u[j + n - 1] };
+            std::uint64_t estimate{ numerator / v[n - 1] };
+            std::uint64_t rest{ numerator % v[n - 1] };
+
+            while (estimate >= base || estimate * v[n - 2] > ((rest << 32) | u[j + n - 2]))
+            {
+                --estimate;
+                rest += v[n - 1];
+
+                if (rest >= base)
+                {
+                    break;
+                }
+            }
+
+            std::int64_t borrow{ 0 };
+            std::int64_t difference{ 0 };
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const std::uint64_t product{ estimate * v[i] };
+                difference = static_cast<std::int64_t>(u[i + j]) - borrow - static_cast<std::int64_t>(product & 0xFFFFFFFF);
+                u[i + j] = static_cast<Limb>(difference);
+                borrow = static_cast<std::int64_t>(product >> 32) - (difference >> 32);
+            }
+
+            difference = static_cast<std::int64_t>(u[j + n]) - borrow;
+            u[j + n] = static_cast<Limb>(difference);
+            quotient[j] = static_cast<Limb>(estimate);
+
+            // The estimate was one too large, add the divisor back.
+            if (difference < 0)
+            {
+                --quotient[j];
+                std::uint64_t carry{ 0 };
+
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    const std::uint64_t sum{ static_cast<std::uint64_t>(u[i + j]) + v[i] + carry };
+                    u[i + j] = static_cast<Limb>(sum);
+                    carry = sum >> 32;
+                }
+
+                u[j + n] = static_cast<Limb>(u[j + n] + carry);
+            }
+        }
+
+        remainder.assign(n, 0);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            remainder[i] = shift ? (u[i] >> shift) | (u[i + 1] << (32 - shift)) : u[i];
+        }
+
+        trim(quotient);
+        trim(remainder);
+    }
+}
+
+BigInteger::BigInteger(const std::int64_t value)
+    : m_negative{ value < 0 }
+{
+    std::uint64_t magnitude{ value < 0 ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value) };
+
+    while (magnitude)
+    {
+        m_limbs.push_back(static_cast<Limb>(magnitude));
+        magnitude >>= 32;
+    }
+}
+
+bool BigInteger::parse(const std::string_view digits, BigInteger& value)
+{
+    if (digits.empty())
+    {
+        return false;
+    }
+
+    BigInteger parsed;
+    std::size_t at{ 0 };
+
+    // The first chunk takes the odd digits so the rest are whole chunks.
+    std::size_t chunk{ digits.size() % decimalChunkDigits };
+    chunk = chunk ? chunk : decimalChunkDigits;
+
+    while (at < digits.size())
+    {
+        Limb part{ 0 };
+        Limb scale{ 1 };
+
+        for (std::size_t i = 0; i < chunk; ++i, ++at)
+        {
+            if (digits[at] < '0' || digits[at] > '9')
+            {
+                return false;
+            }
+
+            part = part * 10 + static_cast<Limb>(digits[at] - '0');
+            scale *= 10;
+        }
+
+        parsed.multiplySmall(scale, part);
+        chunk = decimalChunkDigits;
+    }
+
+    value = std::move(parsed);
+    return true;
+}
+
+BigInteger BigInteger::powerOfTen(std::size_t exponent)
+{
+    BigInteger result{ 1 };
+    BigInteger square{ 10 };
+
+    while (exponent)
+    {
+        if (exponent & 1)
+        {
+            result = result * square;
+        }
+
+        exponent >>= 1;
+
+        if (exponent)
+        {
+            square = square * square;
+        }
+    }
+
+    return result;
+}
+
+std::size_t BigInteger::digitCount() const
+{
+    return isZero() ? 1 : magnitudeDigits().size();
+}
+
+std::string BigInteger::magnitudeDigits() const
+{
+    if (isZero())
+    {
+        return "0";
+    }
+
+    // Peeled off nine digits at a time, least significant chunk first.
+    BigInteger rest{ abs() };
+    std::vector<Limb> chunks;
+
+    while (!rest.isZero())
+    {
+        chunks.push_back(rest.divideSmall(decimalChunk));
+    }
+
+    std::string digits{ std::to_string(chunks.back()) };
+
+    for (std::size_t i = chunks.size() - 1; i-- > 0;)
+    {
+        const std::string part{ std::to_string(chunks[i]) };
+        digits.append(decimalChunkDigits - part.size(), '0');
+        digits += part;
+    }
+
+    return digits;
+}
+
+long double BigInteger::toLongDouble() const
+{
+    long double value{ 0 };
+
+    for (std::size_t i = m_limbs.size(); i-- > 0;)
+    {
+        value = value * 4294967296.0L + m_limbs[i];
+    }
+
+    return m_negative ? -value : value;
+}
+
+BigInteger BigInteger::operator-() const
+{
+    BigInteger negated{ *this };
+    negated.m_negative = !m_negative && !isZero();
+    return negated;
+}
+
+BigInteger BigInteger::abs() const
+{
+    BigInteger magnitude{ *this };
+    magnitude.m_negative = false;
+    return magnitude;
+}
+
+BigInteger operator+(const BigInteger& left, const BigInteger& right)
+{
+    if (left.m_negative == right.m_negative)
+    {
+        return BigInteger::fromMagnitude(add(left.m_limbs, right.m_limbs), left.m_negative);
+    }
+
+    // Opposite signs, the larger magnitude decides the sign.
+    if (BigInteger::compareMagnitude(left, right) >= 0)
+    {
+        Limbs difference{ left.m_limbs };
+        subtractInPlace(difference, right.m_limbs.data(), right.m_limbs.size());
+        return BigInteger::fromMagnitude(std::move(difference), left.m_negative);
+    }
+
+    Limbs difference{ right.m_limbs };
+    subtractInPlace(difference, left.m_limbs.data(), left.m_limbs.size());
+    return BigInteger::fromMagnitude(std::move(difference), right.m_negative);
+}
+
+BigInteger operator-(const BigInteger& left, const BigInteger& right)
+{
+    return left + -right;
+}
+
+BigInteger operator*(const BigInteger& left, const BigInteger& right)
+{
+    return BigInteger::fromMagnitude(
+        multiply(left.m_limbs.data(), left.m_limbs.size(), right.m_limbs.data(), right.m_limbs.size()),
+        left.m_negative != right.m_negative);
+}
+
+void BigInteger::divide(const BigInteger& dividend, const BigInteger& divisor,
+    BigInteger& quotient, BigInteger& remainder)
+{
+    const bool negative{ dividend.m_negative != divisor.m_negative };
+    const bool remainderNegative{ dividend.m_negative };
+
+    if (compareMagnitude(dividend, divisor) < 0)
+    {
+        remainder = dividend;
+        quotient = BigInteger{};
+        return;
+    }
+
+    if (divisor.m_limbs.size() == 1)
+    {
+        BigInteger result{ dividend.abs() };
+        const Limb rest{ result.divideSmall(divisor.m_limbs.front()) };
+
+        quotient = fromMagnitude(std::move(result.m_limbs), negative);
+        remainder = fromMagnitude(rest ? Limbs{ rest } : Limbs{}, remainderNegative);
+        return;
+    }
+
+    Limbs quotientLimbs;
+    Limbs remainderLimbs;
+    divideLong(dividend.m_limbs, divisor.m_limbs, quotientLimbs, remainderLimbs);
+
+    quotient = fromMagnitude(std::move(quotientLimbs), negative);
+    remainder = fromMagnitude(std::move(remainderLimbs), remainderNegative);
+}
+
+void BigInteger::multiplySmall(const Limb factor, const Limb addend)
+{
+    std::uint64_t carry{ addend };
+
+    for (Limb& limb : m_limbs)
+    {
+        const std::uint64_t term{ static_cast<std::uint64_t>(limb) * factor + carry };
+        limb = static_cast<Limb>(term);
+        carry = term >> 32;
+    }
+
+    if (carry)
+    {
+        m_limbs.push_back(static_cast<Limb>(carry));
+    }
+
+    trim(m_limbs);
+    m_negative = m_negative && !isZero();
+}
+
+BigInteger::Limb BigInteger::divideSmall(const Limb divisor)
+{
+    std::uint64_t rest{ 0 };
+
+    for (std::size_t i = m_limbs.size(); i-- > 0;)
+    {
+        const std::uint64_t current{ (rest << 32) | m_limbs[i] };
+        m_limbs[i] = static_cast<Limb>(current / divisor);
+        rest = current % divisor;
+    }
+
+    trim(m_limbs);
+    m_negative = m_negative && !isZero();
+    return static_cast<Limb>(rest);
+}
+
+std::strong_ordering BigInteger::compareMagnitude(const BigInteger& left, const BigInteger& right)
+{
+    return compare(left.m_limbs.data(), left.m_limbs.size(), right.m_limbs.data(), right.m_limbs.size());
+}
+
+std::strong_ordering operator<=>(const BigInteger& left, const BigInteger& right)
+{
+    if (left.m_negative != right.m_negative)
+    {
+        return left.m_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+    }
+
+    const std::strong_ordering magnitude{ BigInteger::compareMagnitude(left, right) };
+    return left.m_negative ? 0 <=> magnitude : magnitude;
+}
+
+BigInteger BigInteger::fromMagnitude(Limbs&& limbs, const bool negative)
+{
+    BigInteger value;
+    value.m_limbs = std::move(limbs);
+    trim(value.m_limbs);
+    value.m_negative = negative && !value.isZero();
+    return value;
+}
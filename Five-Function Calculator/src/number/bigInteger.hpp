@@ -0,0 +1,69 @@
+#ifndef CALCULATOR_BIG_INTEGER_HPP
+#define CALCULATOR_BIG_INTEGER_HPP
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Arbitrary-precision signed integer, a sign and a magnitude of 32-bit limbs,
+// least significant first and without leading zero limbs - zero has none.
+// Products switch from schoolbook to Karatsuba multiplication once both
+// operands reach karatsubaThreshold limbs, division is Knuth's algorithm D.
+class BigInteger
+{
+public:
+    using Limb = std::uint32_t;
+    using Limbs = std::vector<Limb>;
+
+    static constexpr std::size_t karatsubaThreshold{ 32 };
+
+    BigInteger() = default;
+    BigInteger(const std::int64_t value);
+
+    // Decimal digits only, returns false if there are none or any other
+    // character.
+    static bool parse(const std::string_view digits, BigInteger& value);
+    static BigInteger powerOfTen(std::size_t exponent);
+
+    bool isZero() const { return m_limbs.empty(); }
+    bool isNegative() const { return m_negative; }
+    bool isOdd() const { return !m_limbs.empty() && (m_limbs.front() & 1); }
+    const Limbs& limbs() const { return m_limbs; }
+
+    // Decimal digits of the magnitude.
+    std::size_t digitCount() const;
+    std::string magnitudeDigits() const;
+    long double toLongDouble() const;
+
+    BigInteger operator-() const;
+    BigInteger abs() const;
+
+    friend BigInteger operator+(const BigInteger& left, const BigInteger& right);
+    friend BigInteger operator-(const BigInteger& left, const BigInteger& right);
+    friend BigInteger operator*(const BigInteger& left, const BigInteger& right);
+
+    // Truncating division, the remainder takes the dividend's sign. The
+    // divisor must not be zero.
+    static void divide(const BigInteger& dividend, const BigInteger& divisor,
+        BigInteger& quotient, BigInteger& remainder);
+
+    // Magnitude only, in place. divideSmall returns the remainder.
+    void multiplySmall(const Limb factor, const Limb addend = 0);
+    Limb divideSmall(const Limb divisor);
+
+    static std::strong_ordering compareMagnitude(const BigInteger& left, const BigInteger& right);
+
+    friend bool operator==(const BigInteger& left, const BigInteger& right) = default;
+    friend std::strong_ordering operator<=>(const BigInteger& left, const BigInteger& right);
+
+private:
+    static BigInteger fromMagnitude(Limbs&& limbs, const bool negative);
+
+    bool m_negative{ false };
+    Limbs m_limbs;
+};
+
+#endif
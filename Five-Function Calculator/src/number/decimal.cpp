@@ -0,0 +1,355 @@
+#include "decimal.hpp"
+
+#ifdef CALCULATOR_HAS_DECIMAL
+
+#include <limits>
+
+namespace
+{
+    using Unsigned = unsigned __int128;
+
+    constexpr Unsigned limbMask{ std::numeric_limits<std::uint64_t>::max() };
+
+    // A 256-bit magnitude as two 128-bit halves.
+    struct Wide
+    {
+        Unsigned high;
+        Unsigned low;
+    };
+
+    Unsigned magnitude(const Decimal::Units units)
+    {
+        return units < 0 ? -static_cast<Unsigned>(units) : static_cast<Unsigned>(units);
+    }
+
+    Wide multiply(const Unsigned left, const Unsigned right)
+    {
+        const Unsigned left0{ left & limbMask };
+        const Unsigned left1{ left >> 64 };
+        const Unsigned right0{ right & limbMask };
+        const Unsigned right1{ right >> 64 };
+
+        const Unsigned low{ left0 * right0 };
+        const Unsigned cross0{ left0 * right1 };
+        const Unsigned cross1{ left1 * right0 };
+        const Unsigned middle{ (low >> 64) + (cross0 & limbMask) + (cross1 & limbMask) };
+
+        return { left1 * right1 + (cross0 >> 64) + (cross1 >> 64) + (middle >> 64),
+            (middle << 64) | (low & limbMask) };
+    }
+
+    // Schoolbook division one 64-bit limb at a time, the divisor fits a limb.
+    Wide divide(const Wide dividend, const std::uint64_t divisor, Unsigned& remainder)
+    {
+        const std::uint64_t limbs[4]{ static_cast<std::uint64_t>(dividend.high >> 64),
+            static_cast<std::uint64_t>(dividend.high), static_cast<std::uint64_t>(dividend.low >> 64),
+            static_cast<std::uint64_t>(dividend.low) };
+
+        Unsigned quotient[4]{};
+        remainder = 0;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            const Unsigned current{ (remainder << 64) | limbs[i] };
+            quotient[i] = current / divisor;
+            remainder = current % divisor;
+        }
+
+        return { (quotient[0] << 64) | quotient[1], (quotient[2] << 64) | quotient[3] };
+    }
+
+    // Shift and subtract, only for divisors wider than a limb. Their
+    // quotients always fit 128 bits.
+    Unsigned divide(const Wide dividend, const Unsigned divisor, Unsigned& remainder)
+    {
+        Unsigned quotient{ 0 };
+        remainder = 0;
+
+        for (int bit = 255; bit >= 0; --bit)
+        {
+            const Unsigned half{ bit >= 128 ? dividend.high : dividend.low };
+            const bool carry{ (remainder >> 127) != 0 };
+
+            remainder = (remainder << 1) | ((half >> (bit % 128)) & 1);
+            quotient <<= 1;
+
+            if (carry || remainder >= divisor)
+            {
+                remainder -= divisor;
+                quotient |= 1;
+            }
+        }
+
+        return quotient;
+    }
+}
+
+void Decimal::configure(const int scale, const Rounding rounding)
+{
+    s_scale = scale < 0 ? 0 : (scale > maxScale ? maxScale : scale);
+    s_rounding = rounding;
+    s_scaleFactor = 1;
+
+    for (int i = 0; i < s_scale; ++i)
+    {
+        s_scaleFactor *= 10;
+    }
+}
+
+bool Decimal::parse(const std::string_view text, Decimal& value)
+{
+    return parse(text, s_scale, value);
+}
+
+bool Decimal::parsePercent(const std::string_view text, Decimal& percent)
+{
+    return parse(text, maxScale, percent);
+}
+
+Decimal Decimal::asPercent(const Decimal literal)
+{
+    Units units{ literal.m_units };
+
+    for (int i = s_scale; i < maxScale; ++i)
+    {
+        if (__builtin_mul_overflow(units, 10, &units) || units < -maxUnits)
+        {
+            return saturate(literal.m_units < 0);
+        }
+    }
+
+    return fromUnits(units);
+}
+
+bool Decimal::parse(const std::string_view text, const int scale, Decimal& value)
+{
+    std::size_t position{ 0 };
+    std::size_t digitCount{ 0 };
+    int fractionDigits{ 0 };
+
+    const auto isDigit = [&](const std::size_t at) {
+        return at < text.size() && text[at] >= '0' && text[at] <= '9';
+    };
+
+    while (isDigit(position))
+    {
+        ++position;
+        ++digitCount;
+    }
+
+    const std::size_t pointAt{ position };
+
+    if (position < text.size() && text[position] == '.')
+    {
+        ++position;
+
+        while (isDigit(position))
+        {
+            ++position;
+            ++digitCount;
+            ++fractionDigits;
+        }
+    }
+
+    if (digitCount == 0)
+    {
+        return false;
+    }
+
+    const std::size_t mantissaEnd{ position };
+    long exponent{ 0 };
+
+    if (position < text.size() && (text[position] == 'e' || text[position] == 'E'))
+    {
+        std::size_t at{ position + 1 };
+
+        if (at < text.size() && text[at] == '+')
+        {
+            ++at;
+        }
+
+        while (isDigit(at))
+        {
+            // Anything past this is out of range for a non-zero mantissa.
+            if (exponent < 100'000)
+            {
+                exponent = exponent * 10 + (text[at] - '0');
+            }
+
+            ++at;
+        }
+    }
+
+    // Digits at or past keep are rounded off.
+    const long shift{ exponent - fractionDigits + scale };
+    const long keep{ static_cast<long>(digitCount) + shift };
+
+    Unsigned units{ 0 };
+    int roundDigit{ 0 };
+    bool sticky{ false };
+    long index{ 0 };
+
+    for (std::size_t at = 0; at < mantissaEnd; ++at)
+    {
+        if (at == pointAt)
+        {
+            continue;
+        }
+
+        const int digit{ text[at] - '0' };
+
+        if (index < keep)
+        {
+            if (units > (static_cast<Unsigned>(maxUnits) - digit) / 10)
+            {
+                return false;
+            }
+
+            units = units * 10 + digit;
+        }
+        else if (index == keep)
+        {
+            roundDigit = digit;
+        }
+        else
+        {
+            sticky = sticky || digit != 0;
+        }
+
+        ++index;
+    }
+
+    for (long i = 0; i < shift && units; ++i)
+    {
+        if (units > static_cast<Unsigned>(maxUnits) / 10)
+        {
+            return false;
+        }
+
+        units *= 10;
+    }
+
+    const bool tie{ roundDigit == 5 && !sticky };
+
+    if (roundDigit > 5 || (roundDigit == 5 && sticky)
+        || (tie && (s_rounding == Rounding::halfUp || (units & 1))))
+    {
+        if (units == static_cast<Unsigned>(maxUnits))
+        {
+            return false;
+        }
+
+        ++units;
+    }
+
+    value = fromUnits(static_cast<Units>(units));
+    return true;
+}
+
+Decimal operator*(const Decimal left, const Decimal right)
+{
+    const bool negative{ (left.m_units < 0) != (right.m_units < 0) };
+    const Wide product{ multiply(magnitude(left.m_units), magnitude(right.m_units)) };
+
+    Unsigned remainder;
+    const Wide quotient{ divide(product, static_cast<std::uint64_t>(Decimal::s_scaleFactor), remainder) };
+
+    if (quotient.high)
+    {
+        return Decimal::saturate(negative);
+    }
+
+    return Decimal::rounded(negative, quotient.low, remainder,
+        static_cast<Unsigned>(Decimal::s_scaleFactor), product.high == 0 && product.low == 0);
+}
+
+Decimal operator/(const Decimal left, const Decimal right)
+{
+    if (right.m_units == 0)
+    {
+        Decimal::t_faults |= FE_DIVBYZERO;
+        return Decimal{};
+    }
+
+    const bool negative{ (left.m_units < 0) != (right.m_units < 0) };
+    const Wide dividend{ multiply(magnitude(left.m_units), static_cast<Unsigned>(Decimal::s_scaleFactor)) };
+    const Unsigned divisor{ magnitude(right.m_units) };
+
+    Unsigned remainder;
+    Unsigned quotient;
+
+    if (divisor <= limbMask)
+    {
+        const Wide wide{ divide(dividend, static_cast<std::uint64_t>(divisor), remainder) };
+
+        if (wide.high)
+        {
+            return Decimal::saturate(negative);
+        }
+
+        quotient = wide.low;
+    }
+    else if (dividend.high == 0)
+    {
+        quotient = dividend.low / divisor;
+        remainder = dividend.low % divisor;
+    }
+    else
+    {
+        quotient = divide(dividend, divisor, remainder);
+    }
+
+    return Decimal::rounded(negative, quotient, remainder, divisor, left.m_units == 0);
+}
+
+Decimal Decimal::percentOf(const Decimal left, const Decimal percent)
+{
+    const bool negative{ (left.m_units < 0) != (percent.m_units < 0) };
+    const Wide product{ multiply(magnitude(left.m_units), magnitude(percent.m_units)) };
+
+    // Divided by 10^maxScale and then by 100, which together do not fit a
+    // limb. The remainders combine into one of the whole divisor.
+    constexpr std::uint64_t percentFactor{ 1'000'000'000'000'000'000 };
+    static_assert(maxScale == 18, "percentFactor is 10^maxScale");
+
+    Unsigned scaleRemainder;
+    const Wide scaled{ divide(product, percentFactor, scaleRemainder) };
+
+    Unsigned percentRemainder;
+    const Wide quotient{ divide(scaled, std::uint64_t{ 100 }, percentRemainder) };
+
+    if (quotient.high)
+    {
+        return saturate(negative);
+    }
+
+    return rounded(negative, quotient.low, percentRemainder * percentFactor + scaleRemainder,
+        static_cast<Unsigned>(percentFactor) * 100, product.high == 0 && product.low == 0);
+}
+
+Decimal Decimal::rounded(const bool negative, Unsigned quotient,
+    const Unsigned remainder, const Unsigned divisor, const bool exact)
+{
+    // remainder < divisor <= 2^127, doubling it can not wrap.
+    const Unsigned twice{ remainder * 2 };
+
+    if (twice > divisor || (twice == divisor && (s_rounding == Rounding::halfUp || (quotient & 1))))
+    {
+        ++quotient;
+    }
+
+    if (quotient > static_cast<Unsigned>(maxUnits))
+    {
+        return saturate(negative);
+    }
+
+    if (quotient == 0 && !exact)
+    {
+        t_faults |= FE_UNDERFLOW;
+    }
+
+    const Units units{ static_cast<Units>(quotient) };
+    return fromUnits(negative ? -units : units);
+}
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef CALCULATOR_DECIMAL_HPP
+#define CALCULATOR_DECIMAL_HPP
+
+#include <cfenv>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+// 128-bit integers are a GCC and Clang extension, MSVC builds go without the
+// decimal engine.
+#ifdef __SIZEOF_INT128__
+#define CALCULATOR_HAS_DECIMAL
+
+// Exact fixed-point decimal, a signed 128-bit count of units of 10^-scale.
+// Literals are read digit by digit so 0.1 is exactly one tenth, sums and
+// differences are exact and products and quotients are rounded once to the
+// scale. The range is symmetric, so negation never overflows.
+//
+// Faults work like the IEEE sticky flags - an operation that overflows
+// saturates and raises FE_OVERFLOW, division by zero raises FE_DIVBYZERO and
+// a non-zero result that rounds to zero raises FE_UNDERFLOW, in a per-thread
+// set read by faults().
+class Decimal
+{
+public:
+    enum class Rounding : char
+    {
+        halfEven,   // Banker's rounding, ties go to the even unit.
+        halfUp,     // Ties go away from zero.
+    };
+
+    using Units = __int128;
+
+    static constexpr int maxScale{ 18 };
+
+    // Shared by every Decimal, set once before any value is made.
+    static void configure(const int scale, const Rounding rounding);
+    static int scale() { return s_scale; }
+    static Rounding rounding() { return s_rounding; }
+    static std::int64_t scaleFactor() { return s_scaleFactor; }
+
+    static void clearFaults() { t_faults = 0; }
+    static int faults() { return t_faults; }
+
+    static constexpr Units maxUnits{ static_cast<Units>(~static_cast<unsigned __int128>(0) >> 1) };
+
+    static constexpr Decimal fromUnits(const Units units)
+    {
+        Decimal value;
+        value.m_units = units;
+        return value;
+    }
+
+    // Reads digits, an optional decimal point and digits, and an optional
+    // exponent - the longest such prefix, as std::from_chars does. Returns
+    // false when there is no number or it is out of range.
+    static bool parse(const std::string_view text, Decimal& value);
+
+    constexpr Decimal() = default;
+
+    template <std::integral Integer>
+    Decimal(const Integer whole)
+        : m_units{ static_cast<Units>(whole) * s_scaleFactor }
+    { }
+
+    constexpr Units units() const { return m_units; }
+
+    // Truncates toward zero for integer types.
+    template <typename Arithmetic>
+        requires std::is_arithmetic_v<Arithmetic>
+    explicit operator Arithmetic() const
+    {
+        if constexpr (std::is_integral_v<Arithmetic>)
+        {
+            return static_cast<Arithmetic>(m_units / s_scaleFactor);
+        }
+        else
+        {
+            return static_cast<Arithmetic>(m_units) / static_cast<Arithmetic>(s_scaleFactor);
+        }
+    }
+
+    friend Decimal operator+(const Decimal left, const Decimal right)
+    {
+        Units units;
+
+        if (__builtin_add_overflow(left.m_units, right.m_units, &units) || units < -maxUnits)
+        {
+            return saturate(right.m_units < 0);
+        }
+
+        return fromUnits(units);
+    }
+
+    friend Decimal operator-(const Decimal left, const Decimal right)
+    {
+        Units units;
+
+        if (__builtin_sub_overflow(left.m_units, right.m_units, &units) || units < -maxUnits)
+        {
+            return saturate(right.m_units > 0);
+        }
+
+        return fromUnits(units);
+    }
+
+    friend Decimal operator*(const Decimal left, const Decimal right);
+    friend Decimal operator/(const Decimal left, const Decimal right);
+
+    // Percentages are carried as units of 10^-maxScale of their literal,
+    // whatever the scale, so a percent finer than the scale still counts in
+    // full. parsePercent reads one as parse does, up to about 1.7e20,
+    // asPercent converts a value of the scale, saturating, and percentOf is
+    // left * percent / 100 rounded once.
+    static bool parsePercent(const std::string_view text, Decimal& percent);
+    static Decimal asPercent(const Decimal literal);
+    static Decimal percentOf(const Decimal left, const Decimal percent);
+
+    constexpr Decimal operator-() const { return fromUnits(-m_units); }
+
+    Decimal& operator*=(const Decimal right) { return *this = *this * right; }
+
+    friend constexpr bool operator==(const Decimal left, const Decimal right) = default;
+    friend constexpr auto operator<=>(const Decimal left, const Decimal right) = default;
+
+private:
+    static bool parse(const std::string_view text, const int scale, Decimal& value);
+
+    static Decimal saturate(const bool negative)
+    {
+        t_faults |= FE_OVERFLOW;
+        return fromUnits(negative ? -maxUnits : maxUnits);
+    }
+
+    // Rounds quotient + remainder / divisor to a unit. exact says the true
+    // result is zero, any other result that rounds to zero underflows.
+    static Decimal rounded(const bool negative, unsigned __int128 quotient,
+        const unsigned __int128 remainder, const unsigned __int128 divisor, const bool exact);
+
+    static inline int s_scale{ 6 };
+    static inline std::int64_t s_scaleFactor{ 1'000'000 };
+    static inline Rounding s_rounding{ Rounding::halfEven };
+    static inline thread_local int t_faults{ 0 };
+
+    Units m_units{ 0 };
+};
+
+#endif
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef CALCULATOR_NUMBER_TRAITS_HPP
+#define CALCULATOR_NUMBER_TRAITS_HPP
+
+#include "bigDecimal.hpp"
+#include "decimal.hpp"
+
+#include <cerrno>
+#include <cfenv>
+#include <charconv>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#ifdef CALCULATOR_HAS_FLOAT128
+#include <quadmath.h>
+#endif
+
+// What the tokenizer and evaluator need from their numeric type, results are
+// written by formatResult(). The pipeline is instantiated for double, long
+// double, Decimal where 128-bit integers exist, BigDecimal and - where the
+// build links libquadmath and defines CALCULATOR_HAS_FLOAT128 - __float128.
+//
+// Faults are reported the IEEE way, as FE_* flags that stay raised until
+// cleared. Only these four are ever tested.
+constexpr int arithmeticFaults{ FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW | FE_UNDERFLOW };
+
+template <typename Number>
+struct NumberTraits
+{
+    static constexpr Number max() { return std::numeric_limits<Number>::max(); }
+    static constexpr Number lowest() { return std::numeric_limits<Number>::lowest(); }
+    static constexpr Number smallestNormal() { return std::numeric_limits<Number>::min(); }
+    static constexpr int maxExponent10{ std::numeric_limits<Number>::max_exponent10 };
+    static constexpr int digits10{ std::numeric_limits<Number>::digits10 };
+    static constexpr bool exact{ false };
+    static constexpr bool unbounded{ false };
+
+    static void clearFaults() { std::feclearexcept(arithmeticFaults); }
+    static int faults() { return std::fetestexcept(arithmeticFaults); }
+
+    // Kept from the original negation check, which compares against the
+    // smallest normal value rather than anything that could overflow.
+    static bool negationOverflows(const Number value) { return value == smallestNormal(); }
+
+    // A percent literal becomes the share of one it stands for, which the
+    // left operand is multiplied by. The tokenizer passes the literal's text
+    // as well, which exact types read more finely, false when out of range.
+    static Number percentage(const Number literal) { return literal / 100; }
+    static Number percentOf(const Number left, const Number percentage) { return percentage * left; }
+
+    static bool parsePercentage(const std::string_view, const Number literal, Number& percentage)
+    {
+        percentage = literal / 100;
+        return true;
+    }
+
+    // Same rules as std::from_chars, the longest valid prefix is read.
+    static bool parse(const std::string_view text, Number& value)
+    {
+        auto [ptr, err] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return err == std::errc();
+    }
+
+    // Whether text parse() turned away is a number out of range, which a
+    // wider type may still read.
+    static bool outOfRange(const std::string_view text)
+    {
+        Number value;
+        return std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc::result_out_of_range;
+    }
+};
+
+// Trace events carry long double values whatever the pipeline's type.
+template <typename Number>
+long double traceValue(const Number value)
+{
+    return static_cast<long double>(value);
+}
+
+#ifdef CALCULATOR_HAS_FLOAT128
+template <>
+struct NumberTraits<__float128>
+{
+    static constexpr __float128 max() { return FLT128_MAX; }
+    static constexpr __float128 lowest() { return -FLT128_MAX; }
+    static constexpr __float128 smallestNormal() { return FLT128_MIN; }
+    static constexpr int maxExponent10{ FLT128_MAX_10_EXP };
+    static constexpr int digits10{ FLT128_DIG };
+    static constexpr bool exact{ false };
+    static constexpr bool unbounded{ false };
+
+    static void clearFaults() { std::feclearexcept(arithmeticFaults); }
+    static int faults() { return std::fetestexcept(arithmeticFaults); }
+    static bool negationOverflows(const __float128 value) { return value == smallestNormal(); }
+    static __float128 percentage(const __float128 literal) { return literal / 100; }
+    static __float128 percentOf(const __float128 left, const __float128 percentage) { return percentage * left; }
+
+    static bool parsePercentage(const std::string_view, const __float128 literal, __float128& percentage)
+    {
+        percentage = literal / 100;
+        return true;
+    }
+
+    // strtoflt128 also skips leading whitespace and a '+' sign and reads hex
+    // floats, none of which std::from_chars accepts, so those are turned away
+    // first and a hex prefix is read as the zero before it.
+    static bool parse(const std::string_view text, __float128& value)
+    {
+        if (text.empty() || text.front() == ' ' || text.front() == '+'
+            || (text.front() >= '\t' && text.front() <= '\r'))
+        {
+            return false;
+        }
+
+        const std::string terminated{ text.substr(0, text.find_first_of("xX")) };
+        char* end{ nullptr };
+
+        errno = 0;
+        value = strtoflt128(terminated.c_str(), &end);
+
+        return end != terminated.c_str() && errno != ERANGE;
+    }
+
+    static bool outOfRange(const std::string_view text)
+    {
+        __float128 value;
+        return !parse(text, value) && errno == ERANGE;
+    }
+};
+#endif
+
+#ifdef CALCULATOR_HAS_DECIMAL
+template <>
+struct NumberTraits<Decimal>
+{
+    static constexpr Decimal max() { return Decimal::fromUnits(Decimal::maxUnits); }
+    static constexpr Decimal lowest() { return Decimal::fromUnits(-Decimal::maxUnits); }
+    static constexpr Decimal smallestNormal() { return Decimal::fromUnits(1); }
+    static constexpr int maxExponent10{ 39 };
+    static constexpr int digits10{ 38 };
+    static constexpr bool exact{ true };
+    static constexpr bool unbounded{ false };
+
+    static void clearFaults() { Decimal::clearFaults(); }
+    static int faults() { return Decimal::faults(); }
+    static bool negationOverflows(const Decimal) { return false; }
+
+    // Dividing by 100 first would round to the scale twice, so the literal
+    // is carried as written, see Decimal::percentOf.
+    static Decimal percentage(const Decimal literal) { return Decimal::asPercent(literal); }
+    static Decimal percentOf(const Decimal left, const Decimal percentage) { return Decimal::percentOf(left, percentage); }
+
+    static bool parsePercentage(const std::string_view text, const Decimal, Decimal& percentage)
+    {
+        return Decimal::parsePercent(text, percentage);
+    }
+
+    static bool parse(const std::string_view text, Decimal& value) { return Decimal::parse(text, value); }
+
+    // Nothing is wider than the scale allows, out of range is invalid.
+    static bool outOfRange(const std::string_view) { return false; }
+};
+#endif
+
+// No limits to report, exact types never consult them. Formatted results
+// can be any length.
+template <>
+struct NumberTraits<BigDecimal>
+{
+    static BigDecimal max() { return BigDecimal{}; }
+    static BigDecimal lowest() { return BigDecimal{}; }
+    static BigDecimal smallestNormal() { return BigDecimal{}; }
+    static constexpr int maxExponent10{ 64 };
+    static constexpr int digits10{ std::numeric_limits<int>::max() };
+    static constexpr bool exact{ true };
+    static constexpr bool unbounded{ true };
+
+    static void clearFaults() { BigDecimal::clearFaults(); }
+    static int faults() { return BigDecimal::faults(); }
+    static bool negationOverflows(const BigDecimal&) { return false; }
+    static BigDecimal percentage(const BigDecimal& literal) { return literal / 100; }
+    static BigDecimal percentOf(const BigDecimal& left, const BigDecimal& percentage) { return percentage * left; }
+
+    static bool parsePercentage(const std::string_view, const BigDecimal& literal, BigDecimal& percentage)
+    {
+        percentage = literal / 100;
+        return true;
+    }
+
+    static bool parse(const std::string_view text, BigDecimal& value) { return BigDecimal::parse(text, value); }
+    static bool outOfRange(const std::string_view) { return false; }
+};
+
+#endif
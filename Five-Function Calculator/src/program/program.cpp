@@ -0,0 +1,69 @@
+#include "program.hpp"
+
+#include "../number/bigDecimal.hpp"
+#include "../number/decimal.hpp"
+
+template <typename Number>
+Program<Number>::Program(std::pmr::memory_resource* memory)
+    : m_code{ memory },
+    m_constants{ memory }
+{ }
+
+template <typename Number>
+void Program<Number>::clear()
+{
+    m_code.clear();
+    m_constants.clear();
+    m_stackDepth = 0;
+    m_failure = {};
+    m_literalOutOfRange = false;
+    m_placeholders.clear();
+}
+
+template <typename Number>
+const std::pmr::vector<typename Program<Number>::OpCode>& Program<Number>::code() const
+{
+    return m_code;
+}
+
+template <typename Number>
+const std::pmr::vector<Number>& Program<Number>::constants() const
+{
+    return m_constants;
+}
+
+template <typename Number>
+std::size_t Program<Number>::stackDepth() const
+{
+    return m_stackDepth;
+}
+
+template <typename Number>
+std::string_view Program<Number>::failure() const
+{
+    return m_failure;
+}
+
+template <typename Number>
+bool Program<Number>::literalOutOfRange() const
+{
+    return m_literalOutOfRange;
+}
+
+template <typename Number>
+const std::vector<std::string>& Program<Number>::placeholders() const
+{
+    return m_placeholders;
+}
+
+template class Program<double>;
+template class Program<long double>;
+#ifdef CALCULATOR_HAS_FLOAT128
+template class Program<__float128>;
+#endif
+
+#ifdef CALCULATOR_HAS_DECIMAL
+template class Program<Decimal>;
+#endif
+
+template class Program<BigDecimal>;
@@ -0,0 +1,74 @@
+#ifndef CALCULATOR_PROGRAM_HPP
+#define CALCULATOR_PROGRAM_HPP
+
+#include "../enums/enums.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Flat bytecode compiled from an RPN token stream by Evaluator::compile.
+// Every input error is found while compiling, so running a program only has
+// to watch for overflow and underflow in the arithmetic itself. Once compiled
+// a program is immutable and can be evaluated any number of times. Code and
+// constants come from the program's memory resource, the default one unless
+// given.
+template <typename Number = long double>
+class Program
+{
+public:
+    // Opcodes share their values with the matching symbols for tracing,
+    // pushes read the next value from constants() in order and loads read
+    // the index of their placeholder from there.
+    enum class OpCode : char
+    {
+        push = Symbol::none,
+        pushPercentage = Symbol::percentage,
+        load = Symbol::placeholder,
+        loadNegative = Symbol::negativePlaceholder,
+        loadPercentage = Symbol::percentagePlaceholder,
+        add = Symbol::add,
+        subtract = Symbol::subtract,
+        multiply = Symbol::multiply,
+        divide = Symbol::divide,
+        negate = Symbol::negative,
+    };
+
+    Program() = default;
+    explicit Program(std::pmr::memory_resource* memory);
+
+    void clear();
+
+    const std::pmr::vector<OpCode>& code() const;
+    const std::pmr::vector<Number>& constants() const;
+
+    // Largest number of operands on the stack at any point while running.
+    std::size_t stackDepth() const;
+
+    // Result word for an invalid expression, empty when it is valid. The code
+    // is cut off where the error was found, an overflow or underflow while
+    // running takes priority as it would have been reached first.
+    std::string_view failure() const;
+
+    // Whether the failure is a literal out of Number's range, which a wider
+    // type may read, rather than an error in the expression itself.
+    bool literalOutOfRange() const;
+
+    // Names of the values a formula needs, in the order they are supplied.
+    const std::vector<std::string>& placeholders() const;
+
+private:
+    template <typename Trace, typename>
+    friend class Evaluator;
+
+    std::pmr::vector<OpCode> m_code;
+    std::pmr::vector<Number> m_constants;
+    std::size_t m_stackDepth{ 0 };
+    std::string_view m_failure;
+    bool m_literalOutOfRange{ false };
+    std::vector<std::string> m_placeholders;
+};
+
+#endif
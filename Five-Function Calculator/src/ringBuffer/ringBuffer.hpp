@@ -0,0 +1,74 @@
+#ifndef CALCULATOR_RING_BUFFER_HPP
+#define CALCULATOR_RING_BUFFER_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Fixed capacity FIFO that overwrites its oldest entry once full, index 0 is
+// always the oldest entry still held. Storage never grows past the capacity
+// and overwritten slots are reassigned in place.
+template <typename T>
+class RingBuffer
+{
+public:
+    RingBuffer(std::size_t capacity)
+        : m_capacity{ capacity == 0 ? 1 : capacity }
+    {
+        m_items.reserve(m_capacity);
+    }
+
+    void push(T value)
+    {
+        if (m_items.size() < m_capacity)
+        {
+            m_items.push_back(std::move(value));
+            return;
+        }
+
+        m_items[m_head] = std::move(value);
+        m_head = (m_head + 1) % m_capacity;
+        ++m_evicted;
+    }
+
+    const T& operator[](std::size_t index) const
+    {
+        return m_items[(m_head + index) % m_items.size()];
+    }
+
+    void clear()
+    {
+        m_items.clear();
+        m_head = 0;
+        m_evicted = 0;
+    }
+
+    std::size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    bool empty() const
+    {
+        return m_items.empty();
+    }
+
+    // Total number of entries overwritten since construction or clear().
+    std::size_t evicted() const
+    {
+        return m_evicted;
+    }
+
+    std::size_t size() const
+    {
+        return m_items.size();
+    }
+
+private:
+    std::vector<T> m_items;
+    std::size_t m_capacity;
+    std::size_t m_head{ 0 };
+    std::size_t m_evicted{ 0 };
+};
+
+#endif
@@ -0,0 +1,359 @@
+#include "streamEvaluator.hpp"
+
+template <typename Trace, typename Number>
+StreamEvaluator<Trace, Number>::StreamEvaluator(Trace& tracelog, const ResultFormat& format)
+    : m_tracelog{ tracelog },
+    m_tokenizer{ tracelog },
+    m_evaluator{ tracelog, OverflowCheck::perOperation, format }
+{ }
+
+template <typename Trace, typename Number>
+void StreamEvaluator<Trace, Number>::feed(const std::string_view chunk)
+{
+    for (const char c : chunk)
+    {
+        if (!m_failure.empty())
+        {
+            return;
+        }
+
+        scan(c);
+    }
+}
+
+template <typename Trace, typename Number>
+std::string_view StreamEvaluator<Trace, Number>::finish()
+{
+    if (m_pendingMinus)
+    {
+        m_pendingMinus = false;
+        pushOperator(Symbol::subtract);
+    }
+
+    if (!m_number.empty())
+    {
+        endNumber(Symbol::none);
+    }
+
+    m_tracelog.logAllTokensAnalyzed();
+    if (m_nesting)
+    {
+        execute(Token{ Symbol::invalid });
+    }
+
+    while (!m_operators.empty())
+    {
+        m_tracelog.logOpStackToOuptutQueue(m_operators.back());
+        execute(Token{ m_operators.back() });
+        m_operators.pop_back();
+    }
+
+    std::string_view result{ m_failure };
+
+    if (result.empty())
+    {
+        m_tracelog.logExpectOneToken(m_operands.size() == 1);
+        result = m_operands.size() == 1 ? m_evaluator.format(m_operands.back().getValue()) : Word::error;
+    }
+
+    m_number.clear();
+    m_negate = false;
+    m_afterOperator = true;
+    m_operators.clear();
+    m_nesting = 0;
+    m_operands.clear();
+    m_failure = {};
+
+    return result;
+}
+
+// Same decisions as Tokenizer::tokenize, a character at a time.
+template <typename Trace, typename Number>
+void StreamEvaluator<Trace, Number>::scan(const char c)
+{
+    if (m_pendingMinus)
+    {
+        m_pendingMinus = false;
+        resolveMinus(c);
+    }
+
+    if (!m_tokenizer.isOperator(c))
+    {
+        m_tracelog.logFoundNumberComponent(c);
+        m_number += c;
+        return;
+    }
+
+    if (!m_number.empty() && endNumber(c))
+    {
+        return;
+    }
+
+    m_tracelog.logGenerateOperatorToken(c);
+
+    if (c == Symbol::subtract && m_afterOperator)
+    {
+        m_pendingMinus = true;
+        return;
+    }
+
+    pushOperator(c);
+}
+
+template <typename Trace, typename Number>
+bool StreamEvaluator<Trace, Number>::endNumber(const char next)
+{
+    Token number{ m_tokenizer.makeNumber(m_number, m_names, false) };
+    m_number.clear();
+
+    // Percent operator directly after a number, a negated number leaves the
+    // percent sign as an operator.
+    if (next == Symbol::percent && !m_negate)
+    {
+        m_tracelog.logGenerateOperatorToken(next);
+
+        Number percentage = NumberTraits<Number>::percentage(number.getValue());
+        m_tracelog.logDetectedPercentSymbol(traceValue(number.getValue()), traceValue(percentage));
+        shunt(Token{ Symbol::percentage, percentage });
+        m_afterOperator = true;
+        return true;
+    }
+
+    if (m_negate)
+    {
+        m_tracelog.logDetectedNegativeSymbol(traceValue(number.getValue()));
+        number = m_tokenizer.performNegation(number);
+        m_tracelog.logCheckForOverflow(number.getSymbol() == Symbol::overflow);
+    }
+    else
+    {
+        m_tracelog.logNoAnalysisNeeded(number);
+    }
+
+    shunt(number);
+    m_negate = false;
+    m_afterOperator = false;
+    return false;
+}
+
+template <typename Trace, typename Number>
+void StreamEvaluator<Trace, Number>::pushOperator(const char symbol)
+{
+    Token operation{ symbol };
+    m_tracelog.logNoAnalysisNeeded(operation);
+    shunt(operation);
+
+    // A closed group is an operand, like a number.
+    m_afterOperator = symbol != Symbol::closeParenthesis;
+}
+
+// A '-' after an operator is a sign when a number follows, the negative
+// operator when a group does, and subtraction otherwise.
+template <typename Trace, typename Number>
+void StreamEvaluator<Trace, Number>::resolveMinus(const char next)
+{
+    if (next != Symbol::openParenthesis && next != Symbol::closeParenthesis
+        && next != Symbol::add && next != Symbol::subtract && next != Symbol::multiply
+        && next != Symbol::divide && next != Symbol::percent)
+    {
+        m_negate = true;
+        return;
+    }
+
+    if (next == Symbol::openParenthesis)
+    {
+        Token negation{ Symbol::negative };
+        m_tracelog.logNoAnalysisNeeded(negation);
+        shunt(negation);
+        return;
+    }
+
+    pushOperator(Symbol::subtract);
+}
+
+// Same as Evaluator::shunt, tokens leave the yard straight into execute().
+template <typename Trace, typename Number>
+void StreamEvaluator<Trace, Number>::shunt(const Token& token)
+{
+    const char symbol{ token.getSymbol() };
+
+    if (!token.isOperator())
+    {
+        m_tracelog.logMoveToOutputQueue(traceValue(token.getValue()));
+        execute(token);
+        return;
+    }
+
+    m_tracelog.logMoveOperatorToOperatorStack(symbol);
+
+    if (symbol == Symbol::openParenthesis)
+    {
+        if (++m_nesting > Evaluator<Trace, Number>::maxNesting)
+        {
+            execute(Token{ Symbol::invalid });
+            return;
+        }
+
+        m_operators.push_back(symbol);
+        return;
+    }
+
+    if (symbol == Symbol::closeParenthesis)
+    {
+        while (!m_operators.empty() && m_operators.back() != Symbol::openParenthesis)
+        {
+            m_tracelog.logOpStackToOuptutQueue(m_operators.back());
+            execute(Token{ m_operators.back() });
+            m_operators.pop_back();
+        }
+
+        if (m_operators.empty())
+        {
+            execute(Token{ Symbol::invalid });
+            return;
+        }
+
+        m_operators.pop_back();
+        --m_nesting;
+        return;
+    }
+
+    const Prescedence prescedence{ token.getPrescedence() };
+
+    while (symbol != Symbol::negative && !m_operators.empty() && m_operators.back() != Symbol::openParenthesis
+        && SymbolTraits::prescedence(m_operators.back()) >= prescedence)
+    {
+        m_tracelog.logHigherPrescedence(prescedence, SymbolTraits::prescedence(m_operators.back()));
+        execute(Token{ m_operators.back() });
+        m_operators.pop_back();
+    }
+
+    m_tracelog.logPrescedenceOK(symbol);
+    m_operators.push_back(symbol);
+}
+
+// Evaluator::compile's checks and Evaluator::evaluate's arithmetic, one RPN
+// token at a time.
+template <typename Trace, typename Number>
+void StreamEvaluator<Trace, Number>::execute(const Token& token)
+{
+    if (!m_failure.empty())
+    {
+        return;
+    }
+
+    const char symbol{ token.getSymbol() };
+
+    if (!token.isOperator())
+    {
+        bool error{ symbol == Symbol::invalid || symbol == Symbol::outOfRange };
+
+        m_tracelog.logEvalCheckForErrorResult(error);
+        if (error)
+        {
+            m_failure = Word::error;
+            return;
+        }
+
+        bool overflow{ symbol == Symbol::overflow };
+
+        m_tracelog.logCheckForOverflowFlagSet(overflow);
+        if (overflow)
+        {
+            m_failure = Word::overflow;
+            return;
+        }
+
+        bool underflow{ symbol == Symbol::underflow };
+
+        m_tracelog.logCheckForUnderflowFlagSet(underflow);
+        if (underflow)
+        {
+            m_failure = Word::underflow;
+            return;
+        }
+
+        m_tracelog.logNumberToOperandStack(traceValue(token.getValue()));
+        m_operands.push_back(token);
+        return;
+    }
+
+    m_tracelog.logOperatorFound(symbol);
+    const std::size_t operandCount{ static_cast<std::size_t>(token.getOperandCount()) };
+
+    m_tracelog.logCheckingAvailableOperands(static_cast<int>(operandCount));
+    if (operandCount > m_operands.size())
+    {
+        m_tracelog.logErrorFound(m_operands.size());
+        m_failure = Word::error;
+        return;
+    }
+
+    m_tracelog.logFoundSufficientOperands(m_operands.size());
+
+    bool error{ operandCount == 0 };
+
+    m_tracelog.logEvalCheckForErrorResult(error);
+    if (error)
+    {
+        m_failure = Word::error;
+        return;
+    }
+
+    if (symbol == Symbol::negative)
+    {
+        const Number operand{ m_operands.back().getValue() };
+        m_tracelog.logDetectedNegativeSymbol(traceValue(operand));
+
+        const bool overflow{ NumberTraits<Number>::negationOverflows(operand) };
+
+        m_tracelog.logCheckForOverflow(overflow);
+        if (overflow)
+        {
+            m_failure = Word::overflow;
+            return;
+        }
+
+        m_operands.back() = Token{ Symbol::none, -operand };
+        return;
+    }
+
+    const Token right{ m_operands.back() };
+    m_operands.pop_back();
+    m_tracelog.logPullingOperandsFromStack(traceValue(right.getValue()));
+
+    const Token left{ m_operands.back() };
+    m_operands.pop_back();
+    m_tracelog.logPullingOperandsFromStack(traceValue(left.getValue()));
+
+    const Token result{ m_evaluator.doMath(static_cast<OpCode>(symbol), left, right) };
+
+    bool overflow{ result.getSymbol() == Symbol::overflow };
+
+    m_tracelog.logCheckForOverflow(overflow);
+    if (overflow)
+    {
+        m_failure = Word::overflow;
+        return;
+    }
+
+    bool underflow{ result.getSymbol() == Symbol::underflow };
+
+    m_tracelog.logCheckForUnderflow(underflow);
+    if (underflow)
+    {
+        m_failure = Word::underflow;
+        return;
+    }
+
+    m_operands.push_back(result);
+}
+
+template class StreamEvaluator<Tracelog, double>;
+template class StreamEvaluator<Tracelog, long double>;
+template class StreamEvaluator<NoTrace, double>;
+template class StreamEvaluator<NoTrace, long double>;
+#ifdef CALCULATOR_HAS_FLOAT128
+template class StreamEvaluator<Tracelog, __float128>;
+template class StreamEvaluator<NoTrace, __float128>;
+#endif
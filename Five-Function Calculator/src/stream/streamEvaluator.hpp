@@ -0,0 +1,83 @@
+#ifndef CALCULATOR_STREAM_EVALUATOR_HPP
+#define CALCULATOR_STREAM_EVALUATOR_HPP
+
+#include "../enums/enums.hpp"
+#include "../evaluator/evaluator.hpp"
+#include "../format/resultFormat.hpp"
+#include "../number/numberTraits.hpp"
+#include "../program/program.hpp"
+#include "../token/token.hpp"
+#include "../tokenizer/tokenizer.hpp"
+#include "../tracelog/noTrace.hpp"
+#include "../tracelog/tracelog.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Evaluates one expression fed in chunks split anywhere, even inside a
+// number, without ever holding the whole expression. Characters are scanned
+// as they arrive and each stage pushes into the next: a finished token goes
+// straight through the shunting yard, and whatever leaves the yard is
+// executed at once. Memory is the operator and operand stacks, bounded by how
+// deeply the expression nests, plus the text of the number being read.
+//
+//   stream.feed("1234.5*1");
+//   stream.feed("2+7%");
+//   std::string_view result{ stream.finish() };
+//
+// Results match Engine with OverflowCheck::perOperation, the one check a
+// stream supports, so exact types are not streamed. finish() leaves the
+// stream ready for the next expression, its result is a view valid until the
+// next finish().
+template <typename Trace = Tracelog, typename Number = long double>
+class StreamEvaluator
+{
+    static_assert(!NumberTraits<Number>::exact, "exact types are checked with their fault flags, streams check every operation");
+
+public:
+    StreamEvaluator(Trace& tracelog, const ResultFormat& format = {});
+
+    void feed(const std::string_view chunk);
+    std::string_view finish();
+
+private:
+    using Token = ::Token<Number>;
+    using OpCode = typename Program<Number>::OpCode;
+
+    // The three stages, tokenizer, shunting yard and evaluation.
+    void scan(const char c);
+    void shunt(const Token& token);
+    void execute(const Token& token);
+
+    // Returns true when a percent sign was taken by the number.
+    bool endNumber(const char next);
+    void pushOperator(const char symbol);
+    void resolveMinus(const char next);
+
+    Trace& m_tracelog;
+    Tokenizer<Trace, Number> m_tokenizer;
+    Evaluator<Trace, Number> m_evaluator;
+
+    // Placeholders are not streamed, this stays empty.
+    TokenStream<Number> m_names;
+
+    // Tokenizer state carried from one chunk to the next. A '-' after an
+    // operator is only a sign if a number follows, so it waits for the next
+    // character.
+    std::string m_number;
+    bool m_negate{ false };
+    bool m_afterOperator{ true };
+    bool m_pendingMinus{ false };
+
+    std::vector<char> m_operators;
+    std::size_t m_nesting{ 0 };
+
+    // The first problem found decides the result, the rest of the expression
+    // is skipped.
+    std::vector<Token> m_operands;
+    std::string_view m_failure;
+};
+
+#endif
@@ -0,0 +1,139 @@
+#include "workStealingPool.hpp"
+
+namespace
+{
+    std::size_t resolveThreadCount(const std::size_t requested)
+    {
+        if (requested)
+        {
+            return requested;
+        }
+
+        const unsigned hardware{ std::thread::hardware_concurrency() };
+        return hardware ? hardware : 1;
+    }
+}
+
+WorkStealingPool::WorkStealingPool(std::size_t threadCount)
+    : m_size{ resolveThreadCount(threadCount) },
+    m_workers{ std::make_unique<Worker[]>(m_size) }
+{
+    m_threads.reserve(m_size);
+
+    for (std::size_t i = 0; i < m_size; ++i)
+    {
+        m_threads.emplace_back(&WorkStealingPool::run, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard lock{ m_stateMutex };
+        m_stopping = true;
+    }
+
+    m_wake.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+std::size_t WorkStealingPool::size() const
+{
+    return m_size;
+}
+
+void WorkStealingPool::submit(Task task)
+{
+    // Counted first, a worker woken early simply retries until the task lands.
+    {
+        std::lock_guard lock{ m_stateMutex };
+        ++m_queued;
+        ++m_pending;
+    }
+
+    Worker& worker{ m_workers[m_nextWorker] };
+    m_nextWorker = (m_nextWorker + 1) % m_size;
+
+    {
+        std::lock_guard lock{ worker.mutex };
+        worker.tasks.push_back(std::move(task));
+    }
+
+    m_wake.notify_one();
+}
+
+void WorkStealingPool::wait()
+{
+    std::unique_lock lock{ m_stateMutex };
+    m_idle.wait(lock, [this] { return m_pending == 0; });
+}
+
+void WorkStealingPool::run(const std::size_t index)
+{
+    Task task;
+
+    while (true)
+    {
+        if (take(index, task))
+        {
+            {
+                std::lock_guard lock{ m_stateMutex };
+                --m_queued;
+            }
+
+            task(index);
+            task = nullptr;
+
+            std::lock_guard lock{ m_stateMutex };
+
+            if (--m_pending == 0)
+            {
+                m_idle.notify_all();
+            }
+
+            continue;
+        }
+
+        std::unique_lock lock{ m_stateMutex };
+        m_wake.wait(lock, [this] { return m_queued > 0 || m_stopping; });
+
+        if (m_stopping && m_queued == 0)
+        {
+            return;
+        }
+    }
+}
+
+bool WorkStealingPool::take(const std::size_t index, Task& task)
+{
+    {
+        Worker& own{ m_workers[index] };
+        std::lock_guard lock{ own.mutex };
+
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < m_size; ++offset)
+    {
+        Worker& victim{ m_workers[(index + offset) % m_size] };
+        std::lock_guard lock{ victim.mutex };
+
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,61 @@
+#ifndef CALCULATOR_WORK_STEALING_POOL_HPP
+#define CALCULATOR_WORK_STEALING_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads, each with its own task deque. Tasks are dealt
+// round robin, a worker takes from the back of its own deque and steals from
+// the front of the others once it runs dry, so uneven work still ends up
+// spread across every core. Tasks receive the index of the worker running
+// them for per-thread state such as engines and scratch buffers.
+class WorkStealingPool
+{
+public:
+    using Task = std::function<void(std::size_t worker)>;
+
+    // Zero threads uses one per hardware thread.
+    WorkStealingPool(std::size_t threadCount = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    std::size_t size() const;
+
+    // Called by the thread that owns the pool, not from inside tasks.
+    void submit(Task task);
+
+    // Blocks until every submitted task has finished.
+    void wait();
+
+private:
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void run(const std::size_t index);
+    bool take(const std::size_t index, Task& task);
+
+    std::size_t m_size;
+    std::unique_ptr<Worker[]> m_workers;
+    std::vector<std::thread> m_threads;
+    std::size_t m_nextWorker{ 0 };
+
+    std::mutex m_stateMutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_idle;
+    std::size_t m_queued{ 0 };
+    std::size_t m_pending{ 0 };
+    bool m_stopping{ false };
+};
+
+#endif
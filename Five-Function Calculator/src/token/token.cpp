@@ -1,77 +1,86 @@
 #include "token.hpp"
 
-Token::Token(bool isOperator, char character, long double numericValue)
-    : m_operator{ isOperator },
-    m_operandCount{ setOperandCount(character) },
-    m_symbol{ character },
-    m_prescedence{ setPrescedence(character) },
-    m_value{ numericValue }
+#include "../number/bigDecimal.hpp"
+#include "../number/decimal.hpp"
+
+template <typename Number>
+TokenStream<Number>::TokenStream(std::pmr::memory_resource* memory)
+    : m_symbols{ memory },
+    m_values{ memory }
 { }
 
-int Token::getOperandCount() const
+template <typename Number>
+void TokenStream<Number>::clear()
 {
-    return m_operandCount;
+    m_symbols.clear();
+    m_values.clear();
+    m_placeholders.clear();
 }
 
-Prescedence Token::getPrescedence() const
+template <typename Number>
+void TokenStream<Number>::push(const Token<Number>& token)
 {
-    return m_prescedence;
+    m_symbols.push_back(token.getSymbol());
+
+    if (!token.isOperator())
+    {
+        m_values.push_back(token.getValue());
+    }
 }
 
-char Token::getSymbol() const
+template <typename Number>
+std::size_t TokenStream<Number>::addPlaceholder(const std::string_view name)
 {
-    return m_symbol;
+    for (std::size_t i = 0; i < m_placeholders.size(); ++i)
+    {
+        if (m_placeholders[i] == name)
+        {
+            return i;
+        }
+    }
+
+    m_placeholders.emplace_back(name);
+    return m_placeholders.size() - 1;
 }
 
-long double Token::getValue() const
+template <typename Number>
+bool TokenStream<Number>::empty() const
 {
-    return m_value;
+    return m_symbols.empty();
 }
 
-bool Token::isOperator() const
+template <typename Number>
+std::size_t TokenStream<Number>::size() const
 {
-    return m_operator;
+    return m_symbols.size();
 }
 
-int Token::setOperandCount(const char character)
+template <typename Number>
+const std::pmr::vector<char>& TokenStream<Number>::symbols() const
 {
-    switch (character)
-    {
-    case Symbol::negative:
-        return 1;
-
-    case Symbol::multiply:
-        [[fallthrough]];
-    case Symbol::divide:
-        [[fallthrough]];
-    case Symbol::add:
-        [[fallthrough]];
-    case Symbol::subtract:
-        return 2;
+    return m_symbols;
+}
 
-    default:
-        return 0;
-    }
+template <typename Number>
+const std::pmr::vector<Number>& TokenStream<Number>::values() const
+{
+    return m_values;
 }
 
-Prescedence Token::setPrescedence(const char character)
+template <typename Number>
+const std::vector<std::string>& TokenStream<Number>::placeholders() const
 {
-    switch (character)
-    {
-    case Symbol::negative:
-        return Prescedence::negative;
+    return m_placeholders;
+}
 
-    case Symbol::multiply:
-        [[fallthrough]];
-    case Symbol::divide:
-        return Prescedence::multiplyDivide;
+template class TokenStream<double>;
+template class TokenStream<long double>;
+#ifdef CALCULATOR_HAS_FLOAT128
+template class TokenStream<__float128>;
+#endif
 
-    case Symbol::add:
-        [[fallthrough]];
-    case Symbol::subtract:
-        return Prescedence::addSubtract;
+#ifdef CALCULATOR_HAS_DECIMAL
+template class TokenStream<Decimal>;
+#endif
 
-    default:
-        return Prescedence::notApplicable;
-    }
-}
\ No newline at end of file
+template class TokenStream<BigDecimal>;
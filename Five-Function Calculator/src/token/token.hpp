@@ -3,28 +3,113 @@
 
 #include "../enums/enums.hpp"
 
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Operator status, operand count and prescedence are pure functions of the
+// symbol, looked up from tables built at compile time.
+namespace SymbolTraits
+{
+    namespace Detail
+    {
+        struct Entry
+        {
+            bool isOperator{ false };
+            unsigned char operandCount{ 0 };
+            Prescedence prescedence{ Prescedence::notApplicable };
+        };
+
+        constexpr std::array<Entry, 256> table{ [] {
+            std::array<Entry, 256> entries{};
+
+            entries[static_cast<unsigned char>(Symbol::negative)] = { true, 1, Prescedence::negative };
+            entries[static_cast<unsigned char>(Symbol::multiply)] = { true, 2, Prescedence::multiplyDivide };
+            entries[static_cast<unsigned char>(Symbol::divide)] = { true, 2, Prescedence::multiplyDivide };
+            entries[static_cast<unsigned char>(Symbol::add)] = { true, 2, Prescedence::addSubtract };
+            entries[static_cast<unsigned char>(Symbol::subtract)] = { true, 2, Prescedence::addSubtract };
+            entries[static_cast<unsigned char>(Symbol::percent)] = { true, 0, Prescedence::notApplicable };
+            entries[static_cast<unsigned char>(Symbol::openParenthesis)] = { true, 0, Prescedence::notApplicable };
+            entries[static_cast<unsigned char>(Symbol::closeParenthesis)] = { true, 0, Prescedence::notApplicable };
+
+            return entries;
+        }() };
+    }
+
+    constexpr bool isOperator(const char symbol)
+    {
+        return Detail::table[static_cast<unsigned char>(symbol)].isOperator;
+    }
+
+    constexpr int operandCount(const char symbol)
+    {
+        return Detail::table[static_cast<unsigned char>(symbol)].operandCount;
+    }
+
+    constexpr Prescedence prescedence(const char symbol)
+    {
+        return Detail::table[static_cast<unsigned char>(symbol)].prescedence;
+    }
+}
+
+// A number carries its value with Symbol::none, or one of the percentage,
+// invalid, outOfRange, overflow and underflow tags. Placeholders carry the index of their
+// name in the token stream instead of a value. Operators only need their symbol.
+// Number is the pipeline's numeric type, see NumberTraits.
+template <typename Number = long double>
 class Token
 {
 public:
-    Token(bool isOperator, 
-        char symbol = Symbol::none,
-        long double numericValue = 0.0);
+    constexpr Token(char symbol, Number numericValue = 0)
+        : m_value{ numericValue },
+        m_symbol{ symbol }
+    { }
 
-    int getOperandCount() const;
-    Prescedence getPrescedence() const;
-    char getSymbol() const;
-    long double getValue() const;
-    bool isOperator() const;
+    constexpr int getOperandCount() const { return SymbolTraits::operandCount(m_symbol); }
+    constexpr Prescedence getPrescedence() const { return SymbolTraits::prescedence(m_symbol); }
+    constexpr char getSymbol() const { return m_symbol; }
+    constexpr Number getValue() const { return m_value; }
+    constexpr bool isOperator() const { return SymbolTraits::isOperator(m_symbol); }
 
 private:
-    Prescedence setPrescedence(const char character);
-    int setOperandCount(const char character);
-
-    bool m_operator{ false };
-    int m_operandCount{ 0 };
-    Prescedence m_prescedence{ Prescedence::notApplicable };
+    Number m_value{ 0 };
     char m_symbol{ Symbol::none };
-    long double m_value{ 0.0 };
+};
+
+// Structure of arrays token stream - one symbol per token, and one value per
+// number token in the order the numbers appear. Operators take a single
+// byte, and the shunting yard never reorders numbers, so an RPN stream reads
+// its values in the same order as the infix one.
+//
+// Symbols and values come from the stream's memory resource, the default one
+// unless given.
+template <typename Number = long double>
+class TokenStream
+{
+public:
+    TokenStream() = default;
+    explicit TokenStream(std::pmr::memory_resource* memory);
+
+    void clear();
+    void push(const Token<Number>& token);
+
+    // Index of a placeholder name, each distinct name is stored once in the
+    // order it first appears.
+    std::size_t addPlaceholder(const std::string_view name);
+
+    bool empty() const;
+    std::size_t size() const;
+    const std::pmr::vector<char>& symbols() const;
+    const std::pmr::vector<Number>& values() const;
+    const std::vector<std::string>& placeholders() const;
+
+private:
+    std::pmr::vector<char> m_symbols;
+    std::pmr::vector<Number> m_values;
+    std::vector<std::string> m_placeholders;
 };
 
 #endif
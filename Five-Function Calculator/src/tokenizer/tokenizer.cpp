@@ -1,159 +1,247 @@
 #include "tokenizer.hpp"
 
-Tokenizer::Tokenizer(Tracelog& tracelog)
+template <typename Trace, typename Number>
+Tokenizer<Trace, Number>::Tokenizer(Trace& tracelog)
     : m_tracelog{ tracelog }
 { }
 
-std::vector<Token> Tokenizer::tokenize(const std::string_view expression)
+namespace
 {
-    std::vector<Token> tokens;
+    constexpr bool isOperatorSymbol(const char c)
+    {
+        return c == Symbol::add
+            || c == Symbol::subtract
+            || c == Symbol::multiply
+            || c == Symbol::divide
+            || c == Symbol::percent
+            || c == Symbol::openParenthesis
+            || c == Symbol::closeParenthesis;
+    }
+
+    constexpr bool isNameStart(const char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+    }
+
+    constexpr bool isPlaceholderName(const std::string_view text)
+    {
+        if (text.empty() || !isNameStart(text.front()))
+        {
+            return false;
+        }
+
+        for (const char c : text)
+        {
+            if (!isNameStart(c) && !(c >= '0' && c <= '9'))
+            {
+                return false;
+            }
+        }
 
-    auto pos = expression.begin();
+        return true;
+    }
+}
+
+template <typename Trace, typename Number>
+void Tokenizer<Trace, Number>::tokenize(const std::string_view expression, TokenStream<Number>& tokens, const bool allowPlaceholders)
+{
+    tokens.clear();
+
+    size_t scanned = 0;
     size_t numStart = 0;
-    size_t numEnd = 0;
     bool wasNumber = false;
+    bool negate = false;
+
+    // A '-' is a negative sign at the start or straight after another operator.
+    bool afterOperator = true;
 
-    while (pos != expression.end())
+    for (size_t pos = 0; pos < expression.size(); ++pos)
     {
-        if (isOperator(*pos))
+        const char c{ expression[pos] };
+
+        if (!isOperator(c))
         {
-            if (wasNumber)
+            m_tracelog.logFoundNumberComponent(c);
+            if (!wasNumber)
             {
-                numEnd = pos - expression.begin();
-                std::string_view numberString{ expression.substr(numStart, numEnd - numStart) };
+                wasNumber = true;
+                numStart = pos;
+            }
 
-                long double number{};
-                auto [ptr, err] = std::from_chars(numberString.data(), numberString.data() + numberString.size(), number);
+            continue;
+        }
 
-                if (err == std::errc())
+        if (wasNumber)
+        {
+            wasNumber = false;
+            ++scanned;
+
+            const std::string_view numberText{ expression.substr(numStart, pos - numStart) };
+            Token<Number> number{ makeNumber(numberText, tokens, allowPlaceholders) };
+
+            // Percent operator directly after a number, a negated number
+            // leaves the percent sign as an operator.
+            if (c == Symbol::percent && !negate)
+            {
+                ++scanned;
+                m_tracelog.logGenerateOperatorToken(c);
+
+                if (number.getSymbol() == Symbol::placeholder)
                 {
-					m_tracelog.logGenerateNumberToken(numberString);
-					tokens.emplace_back(false, Symbol::none, number);
+                    tokens.push(Token<Number>{ Symbol::percentagePlaceholder, number.getValue() });
+                    afterOperator = true;
+                    continue;
                 }
-                else
+
+                Number percentage{};
+
+                // Text that is not a number still makes an empty percentage.
+                if (number.getSymbol() == Symbol::none
+                    && !NumberTraits<Number>::parsePercentage(numberText, number.getValue(), percentage))
                 {
-                    m_tracelog.logInvalidNumber(numberString);
-					tokens.emplace_back(false, Symbol::invalid, 0.0);
+                    m_tracelog.logInvalidNumber(numberText);
+                    tokens.push(Token<Number>{ Symbol::invalid, 0 });
+                    afterOperator = true;
+                    continue;
                 }
 
-                wasNumber = false;
+                m_tracelog.logDetectedPercentSymbol(traceValue(number.getValue()),
+                    traceValue(NumberTraits<Number>::percentOf(Number{ 1 }, percentage)));
+                tokens.push(Token<Number>{ Symbol::percentage, percentage });
+                afterOperator = true;
+                continue;
             }
 
-            m_tracelog.logGenerateOperatorToken(*pos);
-            tokens.emplace_back(true, *pos );
-            ++pos;
+            emitNumber(number, negate, tokens);
+            negate = false;
+            afterOperator = false;
+        }
+
+        ++scanned;
+        m_tracelog.logGenerateOperatorToken(c);
+
+        // Negative operator, consumed by the number that follows it.
+        if (c == Symbol::subtract && afterOperator
+            && pos + 1 < expression.size() && !isOperatorSymbol(expression[pos + 1]))
+        {
+            negate = true;
             continue;
         }
 
-        m_tracelog.logFoundNumberComponent(*pos);
-        if (!wasNumber)
+        // In front of a group it negates the group's result instead.
+        if (c == Symbol::subtract && afterOperator
+            && pos + 1 < expression.size() && expression[pos + 1] == Symbol::openParenthesis)
         {
-            wasNumber = true;
-            numStart = pos - expression.begin();
+            Token<Number> negation{ Symbol::negative };
+            m_tracelog.logNoAnalysisNeeded(negation);
+            tokens.push(negation);
+            continue;
         }
-        
-        ++pos;
+
+        Token<Number> operation{ c };
+        m_tracelog.logNoAnalysisNeeded(operation);
+        tokens.push(operation);
+
+        // A closed group is an operand, like a number.
+        afterOperator = c != Symbol::closeParenthesis;
     }
 
     if (wasNumber)
     {
-		std::string_view numberString{ expression.substr(numStart) };
-
-		long double number{};
-		auto [ptr, err] = std::from_chars(numberString.data(), numberString.data() + numberString.size(), number);
-
-		if (err == std::errc())
-		{
-			m_tracelog.logGenerateNumberToken(numberString);
-			tokens.emplace_back(false, Symbol::none, number);
-		}
-		else
-		{
-			m_tracelog.logInvalidNumber(numberString);
-			tokens.emplace_back(false, Symbol::invalid, 0.0);
-		}
+        ++scanned;
+        emitNumber(makeNumber(expression.substr(numStart), tokens, allowPlaceholders), negate, tokens);
     }
 
-    m_tracelog.logTokenizerGeneratedCount(tokens.size());
-    return lex(tokens);
+    m_tracelog.logTokenizerGeneratedCount(scanned);
+    m_tracelog.logLexerGeneratedCount(tokens.size());
 }
 
-bool Tokenizer::isOperator(const char c)
+template <typename Trace, typename Number>
+bool Tokenizer<Trace, Number>::isOperator(const char c)
 {
-    constexpr std::array<char, 5> operators{
-        Symbol::add,
-        Symbol::subtract,
-        Symbol::multiply,
-        Symbol::divide,
-        Symbol::percent };
-
-    bool result = std::ranges::count(operators, c);
+    bool result = isOperatorSymbol(c);
     m_tracelog.logIsCharacterOperator(result);
 
     return result;
 }
 
-// Lexer
-std::vector<Token> Tokenizer::lex(const std::vector<Token>& tokens)
+template <typename Trace, typename Number>
+Token<Number> Tokenizer<Trace, Number>::makeNumber(const std::string_view numberString, TokenStream<Number>& tokens, const bool allowPlaceholders)
 {
-    std::vector<Token> lexxed;
+    if (allowPlaceholders && isPlaceholderName(numberString))
+    {
+        m_tracelog.logGenerateNumberToken(numberString);
+        return Token<Number>{ Symbol::placeholder, static_cast<Number>(tokens.addPlaceholder(numberString)) };
+    }
 
-    auto pos = tokens.begin();
+    Number number{};
 
-    while (pos != tokens.end())
+    if (NumberTraits<Number>::parse(numberString, number))
     {
-		// Handle numbers & percent operator.
-        if (!pos->isOperator()) 
-        {
-            if (pos + 1 != tokens.end() && (pos + 1)->getSymbol() == Symbol::percent)
-            {
-                long double percentage = pos->getValue() / 100;
-                m_tracelog.logDetectedPercentSymbol(pos->getValue(), percentage);
-                lexxed.emplace_back(false, Symbol::percent, percentage);
-                pos += 2;
-                continue;
-            }
-
-			m_tracelog.logNoAnalysisNeeded(*pos);
-            lexxed.push_back(*pos);
-            ++pos;
-            continue;
-        }
+        m_tracelog.logGenerateNumberToken(numberString);
+        return Token<Number>{ Symbol::none, number };
+    }
 
-		// Handle negative operator.
-        if (pos->getSymbol() == Symbol::subtract && pos == tokens.begin() 
-			|| pos->getSymbol() == Symbol::subtract && (pos - 1)->isOperator())
-		{
-            if (pos + 1 != tokens.end() && !(pos + 1)->isOperator())
-            {
-                m_tracelog.logDetectedNegativeSymbol((pos + 1)->getValue());
-                Token negated = performNegation(*(pos + 1));
-                m_tracelog.logCheckForOverflow(negated.getSymbol() == Symbol::overflow);
+    m_tracelog.logInvalidNumber(numberString);
+    return Token<Number>{ NumberTraits<Number>::outOfRange(numberString) ? Symbol::outOfRange : Symbol::invalid, 0 };
+}
 
-				lexxed.push_back(negated);
-				pos += 2;
-				continue;
-            }
-		}
+template <typename Trace, typename Number>
+void Tokenizer<Trace, Number>::emitNumber(const Token<Number>& number, const bool negate, TokenStream<Number>& tokens)
+{
+    if (negate)
+    {
+        m_tracelog.logDetectedNegativeSymbol(traceValue(number.getValue()));
+        Token<Number> negated = performNegation(number);
+        m_tracelog.logCheckForOverflow(negated.getSymbol() == Symbol::overflow);
 
-		// Transfer the rest.
-        m_tracelog.logNoAnalysisNeeded(*pos);
-		lexxed.push_back(*pos); 
-        ++pos;
+        tokens.push(negated);
+        return;
     }
 
-    m_tracelog.logLexerGeneratedCount(lexxed.size());
-    return lexxed;
+    m_tracelog.logNoAnalysisNeeded(number);
+    tokens.push(number);
 }
 
-Token Tokenizer::performNegation(const Token& left)
+template <typename Trace, typename Number>
+Token<Number> Tokenizer<Trace, Number>::performNegation(const Token<Number>& left)
 {
-    m_tracelog.logCheckForOverflow(LDBL_MIN == left.getValue());
-    if (LDBL_MIN == left.getValue())
+    if (left.getSymbol() == Symbol::placeholder)
     {
-        return Token{ false, Symbol::overflow, LDBL_MAX };
+        return Token<Number>{ Symbol::negativePlaceholder, left.getValue() };
     }
 
-    long double value = -left.getValue();
-    return Token{ false, Symbol::none, value };
+    // A literal out of range stays so, a wider type may read it.
+    if (left.getSymbol() == Symbol::outOfRange)
+    {
+        return left;
+    }
+
+    const bool overflow{ NumberTraits<Number>::negationOverflows(left.getValue()) };
+
+    m_tracelog.logCheckForOverflow(overflow);
+    if (overflow)
+    {
+        return Token<Number>{ Symbol::overflow, NumberTraits<Number>::max() };
+    }
+
+    Number value = -left.getValue();
+    return Token<Number>{ Symbol::none, value };
 }
+
+template class Tokenizer<Tracelog, double>;
+template class Tokenizer<Tracelog, long double>;
+template class Tokenizer<NoTrace, double>;
+template class Tokenizer<NoTrace, long double>;
+#ifdef CALCULATOR_HAS_FLOAT128
+template class Tokenizer<Tracelog, __float128>;
+template class Tokenizer<NoTrace, __float128>;
+#endif
+
+#ifdef CALCULATOR_HAS_DECIMAL
+template class Tokenizer<Tracelog, Decimal>;
+template class Tokenizer<NoTrace, Decimal>;
+#endif
+
+template class Tokenizer<Tracelog, BigDecimal>;
+template class Tokenizer<NoTrace, BigDecimal>;
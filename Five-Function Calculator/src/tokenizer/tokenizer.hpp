@@ -2,30 +2,42 @@
 #define CALCULATOR_TOKENIZER_HPP
 
 #include "../enums/enums.hpp"
-#include "../token/token.hpp" 
+#include "../number/numberTraits.hpp"
+#include "../token/token.hpp"
+#include "../tracelog/noTrace.hpp"
 #include "../tracelog/tracelog.hpp"
 
-#include <algorithm>
-#include <array>
-#include <climits>
-#include <charconv>
 #include <string>
 #include <string_view>
-#include <vector>
 
+// Trace is the trace policy - Tracelog records every decision, NoTrace compiles
+// every trace point away. Number is the numeric type numbers are read into.
+// Every combination is explicitly instantiated in tokenizer.cpp.
+template <typename Trace = Tracelog, typename Number = long double>
 class Tokenizer
 {
 public:
-    Tokenizer(Tracelog& tracelog);
+    Tokenizer(Trace& tracelog);
 
-    std::vector<Token> tokenize(const std::string_view expression);
+    // Tokenizes and lexes in a single pass, negation and the N% form are
+    // resolved while scanning. Tokens are written to the caller's stream,
+    // which is cleared first so its capacity is reused between calls.
+    // With allowPlaceholders a name such as price or tax_rate becomes a
+    // placeholder for a value supplied at evaluation time, rather than an
+    // invalid number. Parentheses are passed on as tokens, a '-' in front of
+    // one becomes the negative operator.
+    void tokenize(const std::string_view expression, TokenStream<Number>& tokens, const bool allowPlaceholders = false);
 
 private:
+    template <typename, typename>
+    friend class StreamEvaluator;
+
     bool isOperator(const char c);
-    std::vector<Token> lex(const std::vector<Token>& tokens);
-	Token performNegation(const Token& left);
+    Token<Number> makeNumber(const std::string_view numberString, TokenStream<Number>& tokens, const bool allowPlaceholders);
+    void emitNumber(const Token<Number>& number, const bool negate, TokenStream<Number>& tokens);
+	Token<Number> performNegation(const Token<Number>& left);
 
-    Tracelog& m_tracelog;
+    Trace& m_tracelog;
 };
 
 #endif
@@ -0,0 +1,72 @@
+#include "tracelog/binaryTraceSink.hpp"
+#include "tracelog/traceEvent.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Renders a binary trace recorded by BinaryTraceSink into the human readable
+// CalcTrace.txt layout.
+//
+//   calculator_trace_decoder <binary trace> [CalcTrace.txt]
+//
+// Writes to stdout when no output file is given.
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: calculator_trace_decoder <binary trace> [output file]\n";
+        return 1;
+    }
+
+    std::ios::sync_with_stdio(false);
+
+    std::filesystem::path inputPath{ argv[1] };
+    std::ifstream input{ inputPath, std::ios::in | std::ios::binary };
+
+    if (!input.is_open())
+    {
+        std::cerr << "Unable to open binary trace: " << inputPath.string() << '\n';
+        return 1;
+    }
+
+    if (!decodeTraceHeader(input))
+    {
+        std::cerr << "Not a binary trace, or recorded on an incompatible platform: "
+            << inputPath.string() << '\n';
+        return 1;
+    }
+
+    std::ofstream file;
+
+    if (argc == 3)
+    {
+        file.open(argv[2], std::ios::out | std::ios::trunc);
+
+        if (!file.is_open())
+        {
+            std::cerr << "Unable to open output file: " << argv[2] << '\n';
+            return 1;
+        }
+    }
+
+    std::ostream& output{ argc == 3 ? file : std::cout };
+
+    TraceEvent event;
+    std::string text;
+
+    while (input.peek() != std::char_traits<char>::eof())
+    {
+        if (!decodeTraceEvent(input, event, text))
+        {
+            std::cerr << "Binary trace is truncated or corrupt.\n";
+            return 1;
+        }
+
+        output << renderTraceEvent(event);
+    }
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+#include "binaryTraceSink.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+static constexpr std::size_t eventHeaderSize{ 16 };
+
+// Longest text a decoded event may claim when the stream can't tell how much
+// is left, anything longer is taken as corruption.
+static constexpr std::uint64_t maxEventText{ 256 * 1024 * 1024 };
+
+static bool hasText(const TraceEvent::Index id)
+{
+	switch (id)
+	{
+	case TraceEvent::keyPressed:
+		[[fallthrough]];
+	case TraceEvent::clearWarning:
+		[[fallthrough]];
+	case TraceEvent::sendEquationToTokenizer:
+		[[fallthrough]];
+	case TraceEvent::generateNumberToken:
+		[[fallthrough]];
+	case TraceEvent::invalidNumber:
+		[[fallthrough]];
+	case TraceEvent::removingDecimal:
+		[[fallthrough]];
+	case TraceEvent::formatResult:
+		[[fallthrough]];
+	case TraceEvent::displayError:
+		[[fallthrough]];
+	case TraceEvent::displayAnswer:
+		[[fallthrough]];
+	case TraceEvent::message:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+static std::uint8_t valueCount(const TraceEvent::Index id)
+{
+	switch (id)
+	{
+	case TraceEvent::dectedNegativeSymbol:
+		[[fallthrough]];
+	case TraceEvent::noAnalysisNeeded:
+		[[fallthrough]];
+	case TraceEvent::moveToOutputQueue:
+		[[fallthrough]];
+	case TraceEvent::numberToOperandStack:
+		[[fallthrough]];
+	case TraceEvent::pullingOperandsFromStack:
+		return 1;
+
+	case TraceEvent::detectedPercentSymbol:
+		[[fallthrough]];
+	case TraceEvent::higherPrescedence:
+		return 2;
+
+	case TraceEvent::percentArithmetic:
+		[[fallthrough]];
+	case TraceEvent::performArithmetic:
+		return 3;
+
+	default:
+		return 0;
+	}
+}
+
+void encodeTraceHeader(std::string& output)
+{
+	output += binaryTraceMagic;
+	output += binaryTraceVersion;
+	output += static_cast<char>(sizeof(long double));
+}
+
+void encodeTraceEvent(const TraceEvent& event, std::string& output)
+{
+	const bool text{ hasText(event.id) };
+	const std::uint8_t values{ valueCount(event.id) };
+	const std::uint64_t size{ text ? event.text.size() : event.size };
+
+	std::array<char, eventHeaderSize> header{};
+	header[0] = static_cast<char>(event.id);
+	header[1] = event.symbol;
+	header[2] = static_cast<char>(event.flag);
+	header[3] = static_cast<char>(values);
+	std::memcpy(header.data() + 4, &event.counter, sizeof(event.counter));
+	std::memcpy(header.data() + 8, &size, sizeof(size));
+
+	output.append(header.data(), header.size());
+	output.append(reinterpret_cast<const char*>(event.values.data()), values * sizeof(long double));
+
+	if (text)
+	{
+		output += event.text;
+	}
+}
+
+bool decodeTraceHeader(std::istream& input)
+{
+	std::array<char, 6> header{};
+
+	if (!input.read(header.data(), header.size()))
+	{
+		return false;
+	}
+
+	return std::string_view{ header.data(), binaryTraceMagic.size() } == binaryTraceMagic
+		&& header[4] == binaryTraceVersion
+		&& header[5] == static_cast<char>(sizeof(long double));
+}
+
+// Whether size bytes of text can follow, checked before any memory is
+// reserved for them.
+static bool textFits(std::istream& input, const std::uint64_t size)
+{
+	const std::istream::pos_type position{ input.tellg() };
+
+	if (position == std::istream::pos_type(-1))
+	{
+		return size <= maxEventText;
+	}
+
+	input.seekg(0, std::ios::end);
+	const std::istream::pos_type end{ input.tellg() };
+	input.seekg(position);
+
+	return end != std::istream::pos_type(-1) && input
+		&& size <= static_cast<std::uint64_t>(end - position);
+}
+
+bool decodeTraceEvent(std::istream& input, TraceEvent& event, std::string& textStorage)
+{
+	std::array<char, eventHeaderSize> header{};
+
+	if (!input.read(header.data(), header.size()))
+	{
+		return false;
+	}
+
+	event = TraceEvent{};
+	event.id = static_cast<TraceEvent::Index>(header[0]);
+	event.symbol = header[1];
+	event.flag = header[2] != 0;
+	const std::uint8_t values{ static_cast<std::uint8_t>(header[3]) };
+	std::memcpy(&event.counter, header.data() + 4, sizeof(event.counter));
+	std::memcpy(&event.size, header.data() + 8, sizeof(event.size));
+
+	if (event.id >= TraceEvent::indexCount || values > event.values.size())
+	{
+		return false;
+	}
+
+	if (!input.read(reinterpret_cast<char*>(event.values.data()), values * sizeof(long double)))
+	{
+		return false;
+	}
+
+	if (hasText(event.id))
+	{
+		if (!textFits(input, event.size))
+		{
+			return false;
+		}
+
+		textStorage.resize(static_cast<std::size_t>(event.size));
+
+		if (!input.read(textStorage.data(), static_cast<std::streamsize>(event.size)))
+		{
+			return false;
+		}
+
+		event.text = textStorage;
+	}
+
+	return true;
+}
+
+BinaryTraceSink::BinaryTraceSink(const std::filesystem::path& filePath,
+	Durability durability, std::size_t flushSize, std::chrono::milliseconds flushInterval)
+	: BufferedFileSink{ filePath, std::ios::out | std::ios::binary, durability, flushSize, flushInterval }
+{
+	encodeTraceHeader(m_encoded);
+	append(m_encoded);
+}
+
+void BinaryTraceSink::record(const TraceEvent& event)
+{
+	m_encoded.clear();
+	encodeTraceEvent(event, m_encoded);
+	append(m_encoded);
+}
+
+void BinaryTraceSink::write(const std::string& message)
+{
+	record(TraceEvent{ .id = TraceEvent::message, .text = message });
+}
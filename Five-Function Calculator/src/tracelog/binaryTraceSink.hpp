@@ -0,0 +1,50 @@
+#ifndef CALCULATOR_BINARY_TRACE_SINK_HPP
+#define CALCULATOR_BINARY_TRACE_SINK_HPP
+
+#include "bufferedFileSink.hpp"
+#include "traceEvent.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <string>
+#include <string_view>
+
+// Binary trace layout, native byte order and long double width:
+//
+//   file header   "CTRC", format version, sizeof(long double)
+//   event         id, symbol, flag, value count (1 byte each), counter (u32), size (u64)
+//                 followed by value count long doubles, then size bytes of text
+//                 for the events that carry text.
+//
+// Most events are the 16 byte header alone, a few decisions add operand values.
+// traceDecoder renders the file back into the CalcTrace.txt layout.
+constexpr std::string_view binaryTraceMagic{ "CTRC" };
+constexpr char binaryTraceVersion{ 2 };
+
+void encodeTraceHeader(std::string& output);
+void encodeTraceEvent(const TraceEvent& event, std::string& output);
+
+// Both return false on a malformed file or end of input, decoded text is
+// stored in textStorage and event.text points into it.
+bool decodeTraceHeader(std::istream& input);
+bool decodeTraceEvent(std::istream& input, TraceEvent& event, std::string& textStorage);
+
+// Records events in the binary layout through the buffered writer.
+class BinaryTraceSink : public BufferedFileSink
+{
+public:
+	BinaryTraceSink(const std::filesystem::path& filePath,
+		Durability durability = Durability::periodic,
+		std::size_t flushSize = 64 * 1024,
+		std::chrono::milliseconds flushInterval = std::chrono::milliseconds{ 100 });
+
+	void record(const TraceEvent& event) override;
+	void write(const std::string& message) override;
+
+private:
+	std::string m_encoded;
+};
+
+#endif
@@ -0,0 +1,148 @@
+#include "bufferedFileSink.hpp"
+
+BufferedFileSink::BufferedFileSink(const std::filesystem::path& filePath,
+	Durability durability, std::size_t flushSize, std::chrono::milliseconds flushInterval)
+	: BufferedFileSink{ filePath, std::ios::out, durability, flushSize, flushInterval }
+{ }
+
+BufferedFileSink::BufferedFileSink(const std::filesystem::path& filePath, std::ios::openmode mode,
+	Durability durability, std::size_t flushSize, std::chrono::milliseconds flushInterval)
+	: m_file{ filePath, mode | std::ios::trunc },
+	m_durability{ durability },
+	m_flushSize{ flushSize },
+	m_flushInterval{ flushInterval }
+{
+	if (!m_file.is_open())
+	{
+		m_failed = true;
+		return;
+	}
+
+	// Twice the threshold so a burst arriving during a write rarely reallocates.
+	m_buffer.reserve(m_flushSize * 2);
+	m_writing.reserve(m_flushSize * 2);
+
+	if (m_durability != Durability::everyMessage)
+	{
+		m_worker = std::thread{ &BufferedFileSink::flushWorker, this };
+	}
+}
+
+BufferedFileSink::~BufferedFileSink()
+{
+	{
+		std::lock_guard lock{ m_bufferMutex };
+		m_stopping = true;
+	}
+
+	m_flushSignal.notify_one();
+
+	if (m_worker.joinable())
+	{
+		m_worker.join();
+	}
+
+	flush();
+}
+
+void BufferedFileSink::write(const std::string& message)
+{
+	append(message);
+}
+
+void BufferedFileSink::append(std::string_view bytes)
+{
+	if (m_failed)
+	{
+		return;
+	}
+
+	if (m_durability == Durability::everyMessage)
+	{
+		std::lock_guard lock{ m_fileMutex };
+		m_file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+		m_file.flush();
+		m_failed = !m_file.good();
+		return;
+	}
+
+	bool full{ false };
+	{
+		std::lock_guard lock{ m_bufferMutex };
+		m_buffer += bytes;
+		full = m_buffer.size() >= m_flushSize;
+		m_flushRequested = m_flushRequested || full;
+	}
+
+	if (full)
+	{
+		m_flushSignal.notify_one();
+	}
+}
+
+void BufferedFileSink::flush()
+{
+	if (m_failed)
+	{
+		return;
+	}
+
+	writeBuffer();
+}
+
+bool BufferedFileSink::good() const
+{
+	return !m_failed;
+}
+
+void BufferedFileSink::flushWorker()
+{
+	std::unique_lock lock{ m_bufferMutex };
+
+	while (!m_stopping)
+	{
+		if (m_durability == Durability::periodic)
+		{
+			m_flushSignal.wait_for(lock, m_flushInterval,
+				[this] { return m_flushRequested || m_stopping; });
+		}
+		else
+		{
+			m_flushSignal.wait(lock,
+				[this] { return m_flushRequested || m_stopping; });
+		}
+
+		if (m_buffer.empty())
+		{
+			continue;
+		}
+
+		lock.unlock();
+		writeBuffer();
+		lock.lock();
+	}
+}
+
+void BufferedFileSink::writeBuffer()
+{
+	std::lock_guard fileLock{ m_fileMutex };
+	{
+		std::lock_guard bufferLock{ m_bufferMutex };
+		m_writing.swap(m_buffer);
+		m_flushRequested = false;
+	}
+
+	if (m_writing.empty())
+	{
+		return;
+	}
+
+	m_file.write(m_writing.data(), static_cast<std::streamsize>(m_writing.size()));
+	m_file.flush();
+	m_writing.clear();
+
+	if (!m_file.good())
+	{
+		m_failed = true;
+	}
+}
@@ -0,0 +1,71 @@
+#ifndef CALCULATOR_BUFFERED_FILE_SINK_HPP
+#define CALCULATOR_BUFFERED_FILE_SINK_HPP
+
+#include "traceSink.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+// How much trace output may be lost if the process dies unexpectedly.
+enum class Durability
+{
+	everyMessage,	// Written and flushed before write() returns.
+	periodic,		// Flushed by the background thread on size or time threshold.
+	onShutdown,		// Flushed only when the buffer fills, on flush() and at shutdown.
+};
+
+// Keeps the trace file open and appends messages to an in memory buffer that
+// a background thread writes out, so tracing costs a string append instead of
+// an open/seek/write/close per message. flush() is synchronous and is also
+// called from the destructor.
+class BufferedFileSink : public TraceSink
+{
+public:
+	BufferedFileSink(const std::filesystem::path& filePath,
+		Durability durability = Durability::periodic,
+		std::size_t flushSize = 64 * 1024,
+		std::chrono::milliseconds flushInterval = std::chrono::milliseconds{ 100 });
+	~BufferedFileSink() override;
+
+	BufferedFileSink(const BufferedFileSink&) = delete;
+	BufferedFileSink& operator=(const BufferedFileSink&) = delete;
+
+	void write(const std::string& message) override;
+	void flush() override;
+	bool good() const override;
+
+protected:
+	BufferedFileSink(const std::filesystem::path& filePath, std::ios::openmode mode,
+		Durability durability, std::size_t flushSize, std::chrono::milliseconds flushInterval);
+
+	void append(std::string_view bytes);
+
+private:
+	void flushWorker();
+	void writeBuffer();
+
+	std::ofstream m_file;
+	Durability m_durability;
+	std::size_t m_flushSize;
+	std::chrono::milliseconds m_flushInterval;
+
+	std::mutex m_bufferMutex;	// Guards m_buffer, m_flushRequested and m_stopping.
+	std::mutex m_fileMutex;		// Serializes writes so the file keeps message order.
+	std::condition_variable m_flushSignal;
+	std::string m_buffer;
+	std::string m_writing;
+	bool m_flushRequested{ false };
+	bool m_stopping{ false };
+	std::atomic<bool> m_failed{ false };
+	std::thread m_worker;
+};
+
+#endif
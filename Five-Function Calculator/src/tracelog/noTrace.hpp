@@ -0,0 +1,74 @@
+#ifndef CALCULATOR_NO_TRACE_HPP
+#define CALCULATOR_NO_TRACE_HPP
+
+#include "../enums/enums.hpp"
+#include "../token/token.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Trace policy with the same interface as Tracelog where every method is an
+// empty inline function, so Tokenizer<NoTrace> and Evaluator<NoTrace> compile
+// every trace point away - no message formatting, no counters, no output.
+class NoTrace
+{
+public:
+	void disableLogging() {}
+	void enableLogging() {}
+	void disableRecording() {}
+	void enableRecording() {}
+	void flush() {}
+	bool getLogState() const { return false; }
+	bool getRecordState() const { return false; }
+	void log(const std::string&) const {}
+	void resetCounter() {}
+
+	void logButtonPressed(const ButtonID) {}
+	void logKeyPressed(const std::string&) {}
+	void logClearInvalidWarning(const std::string&) {}
+	void logSendEquationToTokenizer(const std::string&) {}
+	void logIsCharacterOperator(const bool) {}
+	void logGenerateOperatorToken(const char) {}
+	void logFoundNumberComponent(const char) {}
+	void logGenerateNumberToken(const std::string_view) {}
+	void logInvalidNumber(const std::string_view) {}
+	void logTokenizerGeneratedCount(const std::size_t) {}
+	void logDetectedPercentSymbol(const long double, const long double) {}
+	void logDetectedNegativeSymbol(const long double) {}
+	template <typename Number>
+	void logNoAnalysisNeeded(const Token<Number>&) {}
+	void logLexerGeneratedCount(const std::size_t) {}
+	void logSendForShunting(const std::size_t) {}
+	void logMoveToOutputQueue(const long double) {}
+	void logMoveOperatorToOperatorStack(const char) {}
+	void logHigherPrescedence(const Prescedence, const Prescedence) {}
+	void logPrescedenceOK(const char) {}
+	void logAllTokensAnalyzed() {}
+	void logOpStackToOuptutQueue(const char) {}
+	void logShuntingComplete(const std::size_t) {}
+	void logNumberToOperandStack(const long double) {}
+	void logOperatorFound(const char) {}
+	void logCheckingAvailableOperands(const int) {}
+	void logErrorFound(const std::size_t) {}
+	void logFoundSufficientOperands(const std::size_t) {}
+	void logPullingOperandsFromStack(const long double) {}
+	void logCallingArithmeticOperation(const char) {}
+	void logCheckForPercentOperator(const bool) {}
+	void logPercentArithmetic(const long double, const long double, const long double) {}
+	void logCheckForOverflow(const bool) {}
+	void logCheckForUnderflow(const bool) {}
+	void logCheckForOverflowFlagSet(const bool) {}
+	void logCheckForUnderflowFlagSet(const bool) {}
+	void logCheckForDivideByZero(const bool) {}
+	void logPerformArithmetic(const char, const long double, const long double, const long double) {}
+	void logExpectOneToken(const bool) {}
+	void logRemovingDecimal(const std::string&) {}
+	void logFormatResult(const std::string_view) {}
+	void logCalcCheckForErrorResult(const bool) {}
+	void logEvalCheckForErrorResult(const bool) {}
+	void logDisplayError(const std::string&) {}
+	void logDisplayAnswer(const std::string&) {}
+};
+
+#endif
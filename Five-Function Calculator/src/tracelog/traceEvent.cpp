@@ -0,0 +1,470 @@
+#include "traceEvent.hpp"
+
+static std::string asString(const ButtonID value)
+{
+	switch (value)
+	{
+	case ButtonID::zero:
+		return "0";
+
+	case ButtonID::one:
+		return "1";
+
+	case ButtonID::two:
+		return "2";
+
+	case ButtonID::three:
+		return "3";
+
+	case ButtonID::four:
+		return "4";
+
+	case ButtonID::five:
+		return "5";
+
+	case ButtonID::six:
+		return "6";
+
+	case ButtonID::seven:
+		return "7";
+
+	case ButtonID::eight:
+		return "8";
+
+	case ButtonID::nine:
+		return "9";
+
+	case ButtonID::decimal:
+		return ".";
+
+	case ButtonID::clear:
+		return "C";
+
+	case ButtonID::clearEntry:
+		return "CE";
+
+	case ButtonID::plus:
+		return "+";
+
+	case ButtonID::minus:
+		return "-";
+
+	case ButtonID::asterisk:
+		return "*";
+
+	case ButtonID::slash:
+		return "/";
+
+	case ButtonID::equals:
+		return "=";
+
+	case ButtonID::percent:
+		return "%";
+
+	case ButtonID::traceON:
+		return "Trace On";
+
+	case ButtonID::traceOFF:
+		return "Trace Off";
+
+	default:
+		return "Forgot to add the new button to asString()!";
+	}
+}
+
+static std::string asString(const Prescedence value)
+{
+	switch (value)
+	{
+	case Prescedence::negative:
+		return "Negation";
+
+	case Prescedence::multiplyDivide:
+		return "Multiplication/Division";
+
+	case Prescedence::addSubtract:
+		return "Addition/Subtraction";
+
+	case Prescedence::notApplicable:
+		return "Not Applicable";
+
+	default:
+		return "Unknown Prescedence!";
+	}
+}
+
+static std::string asString(const bool value)
+{
+	return value ? "Yes" : "No";
+}
+
+static std::string operation(const char symbol)
+{
+	switch (symbol)
+	{
+	case Symbol::add:
+		return "Addition";
+
+	case Symbol::subtract:
+		return "Subtraction";
+
+	case Symbol::multiply:
+		return "Multiplication";
+
+	case Symbol::divide:
+		return "Division";
+
+	default:
+		return "Unknown Operation!";
+	}
+}
+
+std::string renderTraceEvent(const TraceEvent& event)
+{
+	const std::string counter{ std::to_string(event.counter) };
+
+	switch (event.id)
+	{
+	case TraceEvent::buttonPressed:
+		return "CalculatorUI::Button Clicked\n  (count: "
+			+ counter
+			+ ") -> "
+			+ asString(static_cast<ButtonID>(event.size))
+			+ "\n\n";
+
+	case TraceEvent::keyPressed:
+		return "CalculatorUI::Key Pressed\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::string{ event.text }
+			+ "\n\n";
+
+	case TraceEvent::clearWarning:
+		return "CalculatorUI::Clear Invalid Expression Warning\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::string{ event.text }
+			+ "\n\n";
+
+	case TraceEvent::sendEquationToTokenizer:
+		return "CalculatorUI::Sending Equation to Tokenizer\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::string{ event.text }
+			+ "\n\n";
+
+	case TraceEvent::isCharacterOperator:
+		return "Tokenizer::Is Character Operator\n  (count: "
+			+ counter
+			+ ") -> "
+			+ asString(event.flag)
+			+ "\n\n";
+
+	case TraceEvent::generateOperatorToken:
+		return "Tokenizer::Generate Operator Token\n  (count: "
+			+ counter
+			+ ") -> operator "
+			+ event.symbol
+			+ "\n\n";
+
+	case TraceEvent::foundNumberComponent:
+		return "Tokenizer::Found Number Component\n  (count: "
+			+ counter
+			+ ") -> "
+			+ event.symbol
+			+ "\n\n";
+
+	case TraceEvent::generateNumberToken:
+		return "Tokenizer::Generate Number Token\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::string{ event.text }
+			+ "\n\n";
+
+	case TraceEvent::invalidNumber:
+		return "Tokenizer::Invalid Number Found\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::string{ event.text }
+			+ "\n\n";
+
+	case TraceEvent::tokenizerGeneratedCount:
+		return "Tokenizer::Generated "
+			+ std::to_string(event.size)
+			+" Tokens\n  (count: "
+			+ counter
+			+ ") -> Sending tokens to Lexer.\n\n";
+
+	case TraceEvent::detectedPercentSymbol:
+		return "Lexer::Detected Percent Symbol\n  (count: "
+			+ counter
+			+ ") Consumed number token with value "
+			+ std::to_string(event.values[0])
+			+ " -> Generated new Token with percentage value"
+			+ std::to_string(event.values[1])
+			+ "\n\n";
+
+	case TraceEvent::dectedNegativeSymbol:
+		return "Lexer::Detected Negative Symbol\n  (count: "
+			+ counter
+			+ ") Consumed number token with value "
+			+ std::to_string(event.values[0])
+			+ " -> generated new Token with value "
+			+ std::to_string(-event.values[0])
+			+ "\n\n";
+
+	case TraceEvent::noAnalysisNeeded:
+		if (!event.flag)
+		{
+			return "Lexer::No Analysis Needed\n  (count: "
+				+ counter
+				+ ") Transfer Token with value -> "
+				+ std::to_string(event.values[0])
+				+ "\n\n";
+		}
+
+		return "Lexer::No Analysis Needed\n  (count: "
+			+ counter
+			+ ") Transfer Token with operator -> "
+			+ event.symbol
+			+ "\n\n";
+
+	case TraceEvent::lexerGeneratedCount:
+		return "Lexer::Generated Tokens\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::to_string(event.size)
+			+ "\n\n";
+
+	case TraceEvent::sendForShunting:
+		return "Calculator::Sending Tokens to Shunting Yard Algorithm\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::to_string(event.size)
+			+ " tokens.\n\n";
+
+	case TraceEvent::moveToOutputQueue:
+		return "Shunting Yard::Moving Number Token to Ouput Queue\n  (count: "
+			+ counter
+			+ ") Token value -> "
+			+ std::to_string(event.values[0])
+			+ "\n\n";
+
+	case TraceEvent::moveOperatorToOperatorStack:
+		return "Shunting Yard::Operator Found, Moving to Operator Stack\n  (count: "
+			+ counter
+			+ ") -> operator "
+			+ event.symbol
+			+ "\n\n";
+
+	case TraceEvent::higherPrescedence:
+		return "Shunting Yard::Operator Stack Has Higher Prescedence Operator\n  (count: "
+			+ counter
+			+ ") -> "
+			+ asString(static_cast<Prescedence>(event.values[1]))
+			+ " > "
+			+ asString(static_cast<Prescedence>(event.values[0]))
+			+ " moving "
+			+ asString(static_cast<Prescedence>(event.values[1]))
+			+ " to output queue."
+			+ "\n\n";
+
+	case TraceEvent::prescedenceOK:
+		return "Shunting Yard::Operator Prescedence OK\n  (count: "
+			+ counter
+			+ ") -> moving operator "
+			+ event.symbol
+			+ " to output queue."
+			+ "\n\n";
+
+	case TraceEvent::allTokensAnalyzed:
+		return "Shunting Yard::All Tokens Analyzed\n  (count: "
+			+ counter
+			+ ")\n\n";
+
+	case TraceEvent::opStackToOutputQueue:
+		return "Shunting Yard::Moving Remaining Operators From Operator Stack to Output Queue\n  (count: "
+			+ counter
+			+ ") -> operator "
+			+ event.symbol
+			+ "\n\n";
+
+	case TraceEvent::shuntingComplete:
+		return "Calculator::Shunting Complete, Performing Arithmetic Operations On\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::to_string(event.size)
+			+ " tokens."
+			+ "\n\n";
+
+	case TraceEvent::numberToOperandStack:
+		return "Evaluator::Moving Number to Operand Stack\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::to_string(event.values[0])
+			+ "\n\n";
+
+	case TraceEvent::operatorFound:
+		return "Evaluator::Operator Found\n  (count: "
+			+ counter
+			+ ") -> operator "
+			+ event.symbol
+			+ "\n\n";
+
+	case TraceEvent::checkingAvailableOperands:
+		return "Evaluator::Checking for Available Operands\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::to_string(event.size)
+			+" required.\n\n";
+
+	case TraceEvent::errorFound:
+		return "Evaluator::ERROR!\n  (count: "
+			+ counter
+			+ ") -> only "
+			+ std::to_string(event.size)
+			+ " operands available! -> Invalid Expression!\n\n";
+
+	case TraceEvent::foundSufficientOperands:
+		return "Evaluator::Found Sufficient Operands\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::to_string(event.size)
+			+ " available.\n\n";
+
+	case TraceEvent::pullingOperandsFromStack:
+		return "Evaluator::Pulling Operands from Operand Stack\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::to_string(event.values[0])
+			+ "\n\n";
+
+	case TraceEvent::callingArithmeticOperation:
+		return "Evaluator::Calling Arithmetic Operation\n  (count: "
+			+ counter
+			+ ") -> "
+			+ operation(event.symbol)
+			+ "\n\n";
+
+	case TraceEvent::checkForPercentOperator:
+		return "Evaluator::Check for Percent Operator\n  (count: "
+			+ counter
+			+ ") Found? -> "
+			+ asString(event.flag)
+			+ "\n\n";
+
+	case TraceEvent::percentArithmetic:
+		return "Evaluator::Percent Arithmetic\n  (count: "
+			+ counter
+			+ ") "
+			+ std::to_string(event.values[0] * 100)
+			+ "% of "
+			+ std::to_string(event.values[1])
+			+ " -> "
+			+ std::to_string(event.values[2])
+			+ "\n\n";
+
+	case TraceEvent::checkForOverflow:
+		return "Evaluator::Check for Overflow\n  (count: "
+			+ counter
+			+ ") Found? -> "
+			+ asString(event.flag)
+			+ "\n\n";
+
+	case TraceEvent::checkForUnderflow:
+		return "Evaluator::Check for Underflow\n  (count: "
+			+ counter
+			+ ") Found? -> "
+			+ asString(event.flag)
+			+ "\n\n";
+
+	case TraceEvent::checkForOverflowFlag:
+		return "Evaluator::Check for Overflow Flag Set\n  (count: "
+			+ counter
+			+ ") -> "
+			+ asString(event.flag)
+			+ "\n\n";
+
+	case TraceEvent::checkForUnderflowFlag:
+		return "Evaluator::Check for Underflow Flag Set\n  (count: "
+			+ counter
+			+ ") -> "
+			+ asString(event.flag)
+			+ "\n\n";
+
+	case TraceEvent::checkForDivideByZero:
+		return "Evaluator::Check for Divide by Zero\n  (count: "
+			+ counter
+			+ ") Found? -> "
+			+ asString(event.flag)
+			+ "\n\n";
+
+	case TraceEvent::performArithmetic:
+		return "Evaluator::Perform Arithmetic\n  (count: "
+			+ counter
+			+ ") "
+			+ std::to_string(event.values[0])
+			+ ' '
+			+ event.symbol
+			+ ' '
+			+ std::to_string(event.values[1])
+			+ " -> "
+			+ std::to_string(event.values[2])
+			+ "\n\n";
+
+	case TraceEvent::expectOneToken:
+		return "Evaluator::Expect Stack to Have One Token Remaining\n  (count: "
+			+ counter
+			+ ") -> "
+			+ asString(event.flag)
+			+ "\n\n";
+
+	case TraceEvent::removingDecimal:
+		return "Evaluator::Removing Decimal\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::string{ event.text }
+			+ "\n\n";
+
+	case TraceEvent::formatResult:
+		return "Evaluator::Format Result\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::string{ event.text }
+			+ "\n\n";
+
+	case TraceEvent::calcCheckForErrorResult:
+		return "Calculator::Check for Error Result\n  (count: "
+			+ counter
+			+ ") -> "
+			+ asString(event.flag)
+			+ "\n\n";
+
+	case TraceEvent::evalCheckForErrorResult:
+		return "Evaluator::Check for Error Result\n  (count: "
+			+ counter
+			+ ") -> "
+			+ asString(event.flag)
+			+ "\n\n";
+
+	case TraceEvent::displayError:
+		return "Calculator::Display Error\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::string{ event.text }
+			+ "\n\n";
+
+	case TraceEvent::displayAnswer:
+		return "Calculator::Display Answer\n  (count: "
+			+ counter
+			+ ") -> "
+			+ std::string{ event.text }
+			+ "\n\n";
+
+	case TraceEvent::message:
+		return std::string{ event.text };
+
+	default:
+		return "Unknown trace event!\n\n";
+	}
+}
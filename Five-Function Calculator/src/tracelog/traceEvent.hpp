@@ -0,0 +1,78 @@
+#ifndef CALCULATOR_TRACE_EVENT_HPP
+#define CALCULATOR_TRACE_EVENT_HPP
+
+#include "../enums/enums.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// One traced decision. Tracelog records events instead of formatted text so
+// sinks that never show the trace (binary files, NullSink) skip formatting,
+// renderTraceEvent() produces the CalcTrace.txt text on demand.
+struct TraceEvent
+{
+	// Log Counter Indexes
+	enum Index : std::uint8_t
+	{
+		buttonPressed,
+		keyPressed,
+		clearWarning,
+		sendEquationToTokenizer,
+		isCharacterOperator,
+		generateOperatorToken,
+		foundNumberComponent,
+		generateNumberToken,
+		invalidNumber,
+		tokenizerGeneratedCount,
+		detectedPercentSymbol,
+		dectedNegativeSymbol,
+		noAnalysisNeeded,
+		lexerGeneratedCount,
+		sendForShunting,
+		moveToOutputQueue,
+		moveOperatorToOperatorStack,
+		higherPrescedence,
+		prescedenceOK,
+		allTokensAnalyzed,
+		opStackToOutputQueue,
+		shuntingComplete,
+		numberToOperandStack,
+		operatorFound,
+		checkingAvailableOperands,
+		errorFound,
+		foundSufficientOperands,
+		pullingOperandsFromStack,
+		callingArithmeticOperation,
+		checkForPercentOperator,
+		percentArithmetic,
+		checkForOverflow,
+		checkForUnderflow,
+		checkForOverflowFlag,
+		checkForUnderflowFlag,
+		checkForDivideByZero,
+		performArithmetic,
+		expectOneToken,
+		removingDecimal,
+		formatResult,
+		calcCheckForErrorResult,
+		evalCheckForErrorResult,
+		displayError,
+		displayAnswer,
+		message, // Free form text from Tracelog::log().
+		indexCount,
+	};
+
+	Index id{ message };
+	char symbol{ Symbol::none };		// Operator or number component.
+	bool flag{ false };					// Yes / No decisions.
+	std::uint32_t counter{ 0 };			// Per decision count, filled in by Tracelog.
+	std::uint64_t size{ 0 };			// Token counts, operand counts and button IDs.
+	std::array<long double, 3> values{};	// Operands, results and prescedences.
+	std::string_view text{};			// Only valid for the duration of the sink call.
+};
+
+std::string renderTraceEvent(const TraceEvent& event);
+
+#endif
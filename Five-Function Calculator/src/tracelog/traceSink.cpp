@@ -0,0 +1,95 @@
+#include "traceSink.hpp"
+
+void TraceSink::record(const TraceEvent& event)
+{
+	write(renderTraceEvent(event));
+}
+
+void TraceSink::flush()
+{ }
+
+bool TraceSink::good() const
+{
+	return true;
+}
+
+void NullSink::record(const TraceEvent&)
+{ }
+
+void NullSink::write(const std::string&)
+{ }
+
+FileSink::FileSink(const std::filesystem::path& filePath)
+	: m_file{ filePath, std::ios::out | std::ios::trunc }
+{ }
+
+void FileSink::write(const std::string& message)
+{
+	m_file << message;
+}
+
+void FileSink::flush()
+{
+	m_file.flush();
+}
+
+bool FileSink::good() const
+{
+	return m_file.is_open() && m_file.good();
+}
+
+void MemorySink::write(const std::string& message)
+{
+	m_contents += message;
+}
+
+void MemorySink::clear()
+{
+	m_contents.clear();
+}
+
+const std::string& MemorySink::contents() const
+{
+	return m_contents;
+}
+
+TeeSink::TeeSink(std::vector<std::unique_ptr<TraceSink>> sinks)
+	: m_sinks{ std::move(sinks) }
+{ }
+
+void TeeSink::record(const TraceEvent& event)
+{
+	for (const auto& sink : m_sinks)
+	{
+		sink->record(event);
+	}
+}
+
+void TeeSink::write(const std::string& message)
+{
+	for (const auto& sink : m_sinks)
+	{
+		sink->write(message);
+	}
+}
+
+void TeeSink::flush()
+{
+	for (const auto& sink : m_sinks)
+	{
+		sink->flush();
+	}
+}
+
+bool TeeSink::good() const
+{
+	for (const auto& sink : m_sinks)
+	{
+		if (!sink->good())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,77 @@
+#ifndef CALCULATOR_TRACE_SINK_HPP
+#define CALCULATOR_TRACE_SINK_HPP
+
+#include "traceEvent.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Destination for trace output, Tracelog owns one sink for the trace file and
+// one for the on screen display. Events are rendered to text and passed to
+// write() unless the sink overrides record().
+class TraceSink
+{
+public:
+	virtual ~TraceSink() = default;
+
+	virtual void record(const TraceEvent& event);
+	virtual void write(const std::string& message) = 0;
+	virtual void flush();
+	virtual bool good() const;
+};
+
+// Discards everything, used when tracing is not wanted at all.
+class NullSink : public TraceSink
+{
+public:
+	void record(const TraceEvent& event) override;
+	void write(const std::string& message) override;
+};
+
+// Keeps the trace file open for the lifetime of the sink, existing contents
+// are erased when the file is opened.
+class FileSink : public TraceSink
+{
+public:
+	FileSink(const std::filesystem::path& filePath);
+
+	void write(const std::string& message) override;
+	void flush() override;
+	bool good() const override;
+
+private:
+	std::ofstream m_file;
+};
+
+// Collects messages in memory, for callers that want to inspect the trace.
+class MemorySink : public TraceSink
+{
+public:
+	void write(const std::string& message) override;
+
+	void clear();
+	const std::string& contents() const;
+
+private:
+	std::string m_contents;
+};
+
+// Forwards every message to each of the given sinks in order.
+class TeeSink : public TraceSink
+{
+public:
+	TeeSink(std::vector<std::unique_ptr<TraceSink>> sinks);
+
+	void record(const TraceEvent& event) override;
+	void write(const std::string& message) override;
+	void flush() override;
+	bool good() const override;
+
+private:
+	std::vector<std::unique_ptr<TraceSink>> m_sinks;
+};
+
+#endif
@@ -3,39 +3,47 @@
 
 #include "../enums/enums.hpp"
 #include "../token/token.hpp"
-#include "../ui/traceTab.hpp"
-
-#include <wx/notebook.h>
-#include <wx/wx.h>
+#include "traceEvent.hpp"
+#include "traceSink.hpp"
 
 #include <array>
-#include <filesystem>
-#include <fstream>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
 
 class Tracelog
 {
 public:
-	Tracelog(const std::filesystem::path& filePath, wxNotebookPage* traceTab);
+	// Every message goes to the record sink (CalcTrace.txt in the UI), the
+	// display sink only receives messages while logging is enabled.
+	// A missing sink is replaced with a NullSink.
+	Tracelog(std::unique_ptr<TraceSink> recordSink = nullptr,
+		std::unique_ptr<TraceSink> displaySink = nullptr);
 
+	// Logging controls the display sink only, recording controls every trace
+	// point - while recording is off messages are neither formatted nor written.
 	void disableLogging();
+	void disableRecording();
 	void enableLogging();
+	void enableRecording();
+	void flush();
 	bool getLogState() const;
-	void log(const std::string& message) const;
+	bool getRecordState() const;
+	void log(const std::string& message);
 	void resetCounter();
 
 
 private:
-	void checkForExistingFile();
-
-	TraceTab* m_traceTab;
-	std::filesystem::path m_filePath;
+	std::unique_ptr<TraceSink> m_record;
+	std::unique_ptr<TraceSink> m_display;
 	bool m_enabled{ true };
+	bool m_recording{ true };
 
 // Trace Log Methods
 public:
 	void logButtonPressed(const ButtonID button);
-	void logKeyPressed(const wxKeyEvent& event);
+	void logKeyPressed(const std::string& key);
 	void logClearInvalidWarning(const std::string displayed); // Pass by value intentional - wxString conversion.
 	void logSendEquationToTokenizer(const std::string& equation);
 	void logIsCharacterOperator(const bool result);
@@ -46,7 +54,8 @@ public:
 	void logTokenizerGeneratedCount(const size_t count);
 	void logDetectedPercentSymbol(const long double consumed, const long double percentage);
 	void logDetectedNegativeSymbol(const long double consumed);
-	void logNoAnalysisNeeded(const Token& token);
+	template <typename Number>
+	void logNoAnalysisNeeded(const Token<Number>& token);
 	void logLexerGeneratedCount(const size_t count);
 	void logSendForShunting(const size_t count);
 	void logMoveToOutputQueue(const long double value);
@@ -73,76 +82,29 @@ public:
 	void logCheckForDivideByZero(const bool result);
 	void logPerformArithmetic(const char symbol,
 		const long double left, const long double right, const long double result);
-	void logCheckForWholeNumber(const bool result);
 	void logExpectOneToken(const bool result);
 	void logRemovingDecimal(const std::string& result);
-	void logTrimExtraZeroes(const std::string& result);
+	void logFormatResult(const std::string_view result);
 	void logCalcCheckForErrorResult(const bool result);
 	void logEvalCheckForErrorResult(const bool result);
 	void logDisplayError(const std::string error); // Pass by value intentional - wxString conversion.
 	void logDisplayAnswer(const std::string& answer);
-	void logTrimDecimal(const std::string& result);
 
 private:
-	std::string asString(const wxKeyEvent& event) const;
-	std::string asString(const ButtonID value) const;
-	std::string asString(const Prescedence value) const;
-	std::string asString(const bool value) const;
-	std::string operation(const char symbol) const;
+	void record(TraceEvent event);
 
 	// Log Counters
-	std::array<int, 46> counter; // enum Log Counter Indexes count + 1
-
-	// Log Counter Indexes
-	enum Index
-	{
-		buttonPressed,
-		keyPressed,
-		clearWarning,
-		sendEquationToTokenizer,
-		isCharacterOperator,
-		generateOperatorToken,
-		foundNumberComponent,
-		generateNumberToken,
-		invalidNumber,
-		tokenizerGeneratedCount,
-		detectedPercentSymbol,
-		dectedNegativeSymbol,
-		noAnalysisNeeded,
-		lexerGeneratedCount,
-		sendForShunting,
-		moveToOutputQueue,
-		moveOperatorToOperatorStack,
-		higherPrescedence,
-		prescedenceOK,
-		allTokensAnalyzed,
-		opStackToOutputQueue,
-		shuntingComplete,
-		numberToOperandStack,
-		operatorFound,
-		checkingAvailableOperands,
-		errorFound,
-		foundSufficientOperands,
-		pullingOperandsFromStack,
-		callingArithmeticOperation,
-		checkForPercentOperator,
-		percentArithmetic,
-		checkForOverflow,
-		checkForUnderflow,
-		checkForOverflowFlag,
-		checkForUnderflowFlag,
-		checkForDivideByZero,
-		performArithmetic,
-		checkForWholeNumber,
-		expectOneToken,
-		removingDecimal,
-		trimExtraZeroes,
-		calcCheckForErrorResult,
-		evalCheckForErrorResult,
-		displayError,
-		displayAnswer,
-		trimDecimal,
-	};
+	std::array<int, TraceEvent::indexCount> counter;
 };
 
+// Templated on the token's numeric type, values are traced as long double.
+template <typename Number>
+void Tracelog::logNoAnalysisNeeded(const Token<Number>& token)
+{
+	record({ .id = TraceEvent::noAnalysisNeeded,
+		.symbol = token.getSymbol(),
+		.flag = token.isOperator(),
+		.values = { static_cast<long double>(token.getValue()) } });
+}
+
 #endif
@@ -1,12 +1,13 @@
 #include "application.hpp"
 
 Application::Application(const std::string& title, 
-    const std::filesystem::path& pathToLogFile)
+    const std::filesystem::path& pathToLogFile, std::size_t traceCapacity)
     : wxFrame(nullptr, wxID_ANY, title, wxDefaultPosition,
         wxSize(316, 410), wxDEFAULT_FRAME_STYLE),
     m_tabControl{ new wxNotebook(this, wxID_ANY, wxDefaultPosition, wxSize(320, 380)) },
-    m_traceTab{ new TraceTab(m_tabControl) },
-    m_tracelog{ pathToLogFile, m_traceTab },
+    m_traceTab{ new TraceTab(m_tabControl, traceCapacity) },
+    m_tracelog{ std::make_unique<BufferedFileSink>(pathToLogFile),
+        std::make_unique<TraceTabSink>(*static_cast<TraceTab*>(m_traceTab)) },
     m_calcTab{ new CalculatorTab(m_tabControl, m_tracelog) }
 {
     wxBoxSizer* sizer{ new wxBoxSizer(wxVERTICAL) };
@@ -27,4 +28,8 @@ void Application::setCorrectFocus(const wxBookCtrlEvent& event)
     {
         m_calcTab->SetFocus();
     }
+    else if (m_tabControl->GetPage(event.GetSelection()) == m_traceTab)
+    {
+        static_cast<TraceTab*>(m_traceTab)->refresh();
+    }
 }
@@ -3,22 +3,27 @@
 
 #include "calculatorTab.hpp"
 #include "traceTab.hpp"
+#include "../tracelog/bufferedFileSink.hpp"
 #include "../tracelog/tracelog.hpp"
 
 #include <wx/wx.h>
 #include <wx/notebook.h>
 
+#include <cstddef>
+#include <memory>
 #include <string>
 
 class Application : public wxFrame
 {
 public:
     Application(const std::string& title,
-        const std::filesystem::path& pathToLogFile);
+        const std::filesystem::path& pathToLogFile,
+        std::size_t traceCapacity = defaultTraceCapacity);
 
 private:
 	// When tab changes back to page 1 (Calculator Tab)
-	// set focus so keyboard inputs are captured correctly.
+	// set focus so keyboard inputs are captured correctly,
+	// when it changes to the Trace Tab bring the trace up to date.
     void setCorrectFocus(const wxBookCtrlEvent& event);
 
     wxNotebook* m_tabControl;
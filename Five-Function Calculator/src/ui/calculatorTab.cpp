@@ -1,16 +1,13 @@
 #include "calculatorTab.hpp"
 
 #include "../enums/enums.hpp"
-#include "../token/token.hpp"
-#include "../tokenizer/tokenizer.hpp"
-#include "../evaluator/evaluator.hpp"
+#include "../engine/engine.hpp"
 
 
 CalculatorTab::CalculatorTab(wxNotebook* control, Tracelog& tracelog)
     : wxWindow(control, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxWANTS_CHARS),
     m_tracelog{ tracelog },
-    m_tokenizer{ tracelog },
-    m_evaluator{ tracelog }
+    m_engine{ tracelog }
 {
     Bind(wxEVT_CHAR_HOOK, &CalculatorTab::handleKeyboardInput, this);
 
@@ -20,6 +17,117 @@ CalculatorTab::CalculatorTab(wxNotebook* control, Tracelog& tracelog)
     toggleTraceLog();
 }
 
+std::string CalculatorTab::asString(const wxKeyEvent& event) const
+{
+    switch (event.GetKeyCode())
+    {
+    case WXK_NUMPAD0:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::zero):
+		return "0";
+
+    case WXK_NUMPAD1:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::one):
+		return "1";
+
+    case WXK_NUMPAD2:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::two):
+		return "2";
+
+    case WXK_NUMPAD3:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::three):
+		return "3";
+
+    case WXK_NUMPAD4:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::four):
+		return "4";
+
+    case WXK_NUMPAD5:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::five):
+        if (event.GetModifiers() == wxMOD_SHIFT)
+        {
+			return "%";
+        }
+		return "5";
+        break;
+
+    case WXK_NUMPAD6:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::six):
+		return "6";
+
+    case WXK_NUMPAD7:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::seven):
+		return "7";
+
+    case WXK_NUMPAD8:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::eight):
+		return "8";
+
+    case WXK_NUMPAD9:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::nine):
+		return "9";
+
+    case WXK_NUMPAD_DECIMAL:
+        [[fallthrough]];
+    case WXK_DECIMAL:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::decimal):
+		return ".";
+
+    case WXK_ESCAPE:
+		return "Clear";
+
+    case WXK_BACK:
+		return "Clear Entry";
+
+    case WXK_NUMPAD_ADD:
+        [[fallthrough]];
+    case WXK_ADD:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::plus):
+		return "+";
+
+    case WXK_NUMPAD_SUBTRACT:
+        [[fallthrough]];
+    case WXK_SUBTRACT:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::minus):
+		return "-";
+
+    case WXK_NUMPAD_MULTIPLY:
+        [[fallthrough]];
+    case WXK_MULTIPLY:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::asterisk):
+		return "*";
+
+    case WXK_NUMPAD_DIVIDE:
+        [[fallthrough]];
+    case WXK_DIVIDE:
+        [[fallthrough]];
+    case static_cast<int>(ASCII::slash):
+		return "/";
+
+    case WXK_NUMPAD_EQUAL:
+        [[fallthrough]];
+    case WXK_RETURN:
+		return "=";
+
+    default:
+		// Usually triggered by the shift key when pressing %.
+		return "Invalid Key Ignored";
+    }
+}
+
 void CalculatorTab::clearDisplayIfClearFlagSet()
 {
 	if (m_clearOnNextDigit)
@@ -47,13 +155,7 @@ void CalculatorTab::enterPressed()
 
     m_tracelog.logSendEquationToTokenizer(expression);
 
-    std::vector<Token> tokens{ m_tokenizer.tokenize(std::string_view{ expression }) };
-    m_tracelog.logSendForShunting(tokens.size());
-
-    std::queue<Token> queue{ m_evaluator.shunt(tokens) };
-    m_tracelog.logShuntingComplete(queue.size());
-
-    std::string answer{ m_evaluator.evaluate(queue) };
+    std::string answer{ m_engine.evaluate(std::string_view{ expression }) };
     m_tracelog.logCalcCheckForErrorResult(answer == Word::error
         || answer == Word::underflow
         || answer == Word::overflow);
@@ -68,6 +170,9 @@ void CalculatorTab::enterPressed()
 	m_listBox->SetValue(m_invalid + expression);
 	m_tracelog.logDisplayError(m_listBox->GetValue().ToStdString());
     m_tracelog.resetCounter();
+
+    // Make sure the trace leading up to the error reaches CalcTrace.txt.
+    m_tracelog.flush();
 }
 
 void CalculatorTab::handleButtonPress(const wxCommandEvent& event)
@@ -186,7 +291,7 @@ void CalculatorTab::handleButtonPress(const wxCommandEvent& event)
 
 void CalculatorTab::handleKeyboardInput(const wxKeyEvent& event)
 {
-    m_tracelog.logKeyPressed(event);
+    m_tracelog.logKeyPressed(asString(event));
     clearInvalidExpressionWarning();
 
     switch (event.GetKeyCode())
@@ -2,8 +2,7 @@
 #define CALCULATOR_CALCULATOR_TAB_HPP
 
 #include "../enums/enums.hpp"
-#include "../evaluator/evaluator.hpp"
-#include "../tokenizer/tokenizer.hpp"
+#include "../engine/engine.hpp"
 #include "../tracelog/tracelog.hpp"
 
 #include <wx/gbsizer.h>
@@ -19,6 +18,7 @@ public:
 	CalculatorTab(wxNotebook* control, Tracelog& tracelog);
 
 private:
+	std::string asString(const wxKeyEvent& event) const;
 	void clearDisplayIfClearFlagSet();
 	void clearInvalidExpressionWarning();
 	void enterPressed();
@@ -30,8 +30,7 @@ private:
 	void toggleTraceLog();
 
 	Tracelog& m_tracelog;
-	Tokenizer m_tokenizer;
-	Evaluator m_evaluator;
+	Engine<Tracelog> m_engine;
 	bool m_clearOnNextDigit{ false };
 	std::string m_invalid{ "Invalid Expression->" };
 
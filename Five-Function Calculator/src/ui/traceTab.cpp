@@ -1,13 +1,116 @@
 #include "traceTab.hpp"
 
-TraceTab::TraceTab(wxNotebook* control)
-    : wxWindow(control, wxID_ANY)
+TraceList::TraceList(wxWindow* parent, const RingBuffer<std::string>& entries)
+    : wxListCtrl(parent, wxID_ANY, wxDefaultPosition, wxDefaultSize,
+        wxLC_REPORT | wxLC_VIRTUAL | wxLC_NO_HEADER | wxLC_SINGLE_SEL),
+    m_entries{ entries }
 {
+    InsertColumn(0, "Trace");
+    SetColumnWidth(0, 1000);
+}
+
+wxString TraceList::OnGetItemText(long item, long) const
+{
+    if (item < 0 || static_cast<std::size_t>(item) >= m_entries.size())
+    {
+        return wxEmptyString;
+    }
+
+    // Messages are laid out over several lines for CalcTrace.txt,
+    // fold them onto a single row for the list.
+    const std::string& message{ m_entries[static_cast<std::size_t>(item)] };
+    std::string row;
+    row.reserve(message.size());
+
+    for (const char c : message)
+    {
+        if (c != '\n')
+        {
+            row += c;
+        }
+        else if (!row.empty() && row.back() != ' ')
+        {
+            row += ' ';
+        }
+    }
+
+    while (!row.empty() && row.back() == ' ')
+    {
+        row.pop_back();
+    }
+
+    return wxString{ row };
+}
+
+TraceTab::TraceTab(wxNotebook* control, std::size_t capacity)
+    : wxWindow(control, wxID_ANY),
+    m_entries{ capacity }
+{
+    m_evictedLabel->Hide();
+    m_fitToWindow->Add(m_evictedLabel, wxSizerFlags(0).Expand().Border(wxLEFT | wxRIGHT | wxTOP, 5));
     m_fitToWindow->Add(m_listBox, wxSizerFlags(1).Expand().Border(wxALL, 5));
     SetSizerAndFit(m_fitToWindow);
+
+    Bind(wxEVT_IDLE, &TraceTab::refreshWhenVisible, this);
 }
 
 void TraceTab::logMessage(const std::string& message)
 {
-    m_listBox->AppendText(message);
+    m_entries.push(message);
+    m_stale = true;
+}
+
+void TraceTab::refresh()
+{
+    if (!m_stale)
+    {
+        return;
+    }
+
+    m_stale = false;
+    m_listBox->SetItemCount(static_cast<long>(m_entries.size()));
+    m_listBox->Refresh();
+    m_listBox->EnsureVisible(static_cast<long>(m_entries.size()) - 1);
+
+    updateEvictedLabel();
+}
+
+// Messages pile up while the event loop is busy evaluating, the first idle
+// event afterwards shows them all at once. A hidden tab is caught up by
+// Application when it is selected.
+void TraceTab::refreshWhenVisible(wxIdleEvent& event)
+{
+    if (IsShownOnScreen())
+    {
+        refresh();
+    }
+
+    event.Skip();
+}
+
+void TraceTab::updateEvictedLabel()
+{
+    if (m_entries.evicted() == m_shownEvicted)
+    {
+        return;
+    }
+
+    m_shownEvicted = m_entries.evicted();
+    m_evictedLabel->SetLabel(std::to_string(m_shownEvicted)
+        + " older trace entries discarded, see CalcTrace.txt for the full trace.");
+
+    if (!m_evictedLabel->IsShown())
+    {
+        m_evictedLabel->Show();
+        Layout();
+    }
+}
+
+TraceTabSink::TraceTabSink(TraceTab& traceTab)
+    : m_traceTab{ traceTab }
+{ }
+
+void TraceTabSink::write(const std::string& message)
+{
+    m_traceTab.logMessage(message);
 }
@@ -1,24 +1,67 @@
 #ifndef CALCULATOR_TRACE_TAB_HPP
 #define CALCULATOR_TRACE_TAB_HPP
 
+#include "../ringBuffer/ringBuffer.hpp"
+#include "../tracelog/traceSink.hpp"
+
+#include <wx/listctrl.h>
 #include <wx/msgdlg.h>
 #include <wx/notebook.h>
+#include <wx/stattext.h>
 #include <wx/wx.h>
 
+#include <cstddef>
 #include <string>
 
+constexpr std::size_t defaultTraceCapacity{ 10'000 };
+
+// Virtual list over the trace entries, only the rows on screen are ever
+// converted to wxStrings.
+class TraceList : public wxListCtrl
+{
+public:
+    TraceList(wxWindow* parent, const RingBuffer<std::string>& entries);
+
+private:
+    wxString OnGetItemText(long item, long column) const override;
+
+    const RingBuffer<std::string>& m_entries;
+};
+
 class TraceTab : public wxNotebookPage
 {
 public:
-    TraceTab(wxNotebook* control);
+    // Keeps the newest capacity messages, older ones are discarded and counted.
+    TraceTab(wxNotebook* control, std::size_t capacity = defaultTraceCapacity);
 
+    // Stores the message, the list itself is only brought up to date by
+    // refresh() so a burst of messages costs a single repaint.
     void logMessage(const std::string& message);
+    void refresh();
 
 private:
+    void refreshWhenVisible(wxIdleEvent& event);
+    void updateEvictedLabel();
+
+    RingBuffer<std::string> m_entries;
+    std::size_t m_shownEvicted{ 0 };
+    bool m_stale{ false };
+
     wxBoxSizer* m_fitToWindow{ new wxBoxSizer(wxVERTICAL) };
-    wxTextCtrl* m_listBox{ new wxTextCtrl(
-        this, wxID_ANY, wxEmptyString, wxDefaultPosition, wxDefaultSize,
-        wxTE_MULTILINE | wxTE_READONLY) };
+    wxStaticText* m_evictedLabel{ new wxStaticText(this, wxID_ANY, wxEmptyString) };
+    TraceList* m_listBox{ new TraceList(this, m_entries) };
+};
+
+// Routes trace messages to the Trace Logic tab.
+class TraceTabSink : public TraceSink
+{
+public:
+    TraceTabSink(TraceTab& traceTab);
+
+    void write(const std::string& message) override;
+
+private:
+    TraceTab& m_traceTab;
 };
 
 #endif